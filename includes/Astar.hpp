@@ -4,11 +4,11 @@
 #include "Puzzle.hpp"
 #include "Node.hpp"
 #include "Heuristic.hpp"
+#include "BucketQueue.hpp"
 #include <map>
 #include <string>
 #include <vector>
 #include <cstdint>
-#include <memory>
 #include <unordered_map>
 
 struct AStarResult {
@@ -19,19 +19,13 @@ struct AStarResult {
     double executionTime;
     int heuristicId;
     std::string heuristicName;
-    int algorithmId;  // 1 = A*
+    int algorithmId;  // 1 = A*, 8 = IDA*, 9 = Bidirectional MM, 10 = HDA*, 11 = EPEA*, 12 = Frontier A*, 13 = External A*, 14 = ARA*
     std::string algorithmName;
     bool memoryLimitReached;
     std::string failureReason;
     double weight;  // Weight parameter for weighted A* (1.0 = standard A*)
-};
-
-// Comparator for priority queue of shared_ptr<Node>
-struct NodePtrComparator {
-    bool operator()(const std::shared_ptr<Node>& a, const std::shared_ptr<Node>& b) const {
-        // For min-heap, return true if a has HIGHER priority (worse f-value)
-        return a->getFValue() > b->getFValue();
-    }
+    std::vector<long long> threadNodes = {};  // States expanded by each worker (parallel IDA*)
+    int tieBreaking = -1;  // TieBreaking of the open list (-1 = engines without one)
 };
 
 class Astar {
@@ -42,23 +36,28 @@ class Astar {
         Astar& operator=(const Astar& other);
 
         // A* with memory limit and timeout
-        AStarResult solve(Puzzle& puzzle, int size, int heuristic, bool silent = false, 
-                         size_t maxStates = 0, double maxTimeSeconds = 0);  // 0 = use default from macros
+        template <int N>
+        AStarResult solve(Puzzle& puzzle, int heuristic, bool silent = false, 
+                         size_t maxStates = 0, double maxTimeSeconds = 0,  // 0 = use default from macros
+                         TieBreaking tieBreaking = TIE_HIGH_G);
         
         // Memory management
+        template <int N>
         static size_t estimateMemoryUsage(size_t numStates);
 
     private:
         // Helper functions
+        template <int N>
         struct Neighbor {
-            std::vector<uint8_t> state;
+            State<N> state;
             uint8_t zeroPos;
-            std::string action;
+            uint8_t move;       // MoveDirection of the blank
         };
         
-        void getNeighbors(const Node& node, std::vector<Neighbor>& neighbors);
-        bool isGoal(const std::vector<uint8_t>& state, 
-                   const std::vector<uint8_t>& goal);
+        template <int N>
+        void getNeighbors(const Node<N>& node, std::vector<Neighbor<N>>& neighbors);
+        template <int N>
+        bool isGoal(const State<N>& state, const State<N>& goal);
 };
 
 #endif
@@ -4,11 +4,13 @@
 #include "Puzzle.hpp"
 #include "Node.hpp"
 #include "Heuristic.hpp"
+#include "BucketQueue.hpp"
+#include "StateTable.hpp"
+#include <chrono>
 #include <map>
 #include <string>
 #include <vector>
 #include <cstdint>
-#include <memory>
 #include <unordered_map>
 
 struct BeamSearchResult {
@@ -19,19 +21,12 @@ struct BeamSearchResult {
     double executionTime;
     int heuristicId;
     std::string heuristicName;
-    int algorithmId;  // 7 = Beam Search
+    int algorithmId;  // 7 = Beam Search, 15 = Beam-stack search
     std::string algorithmName;
     bool memoryLimitReached;
     std::string failureReason;
     int beamWidth;  // k parameter for beam search
-};
-
-// Comparator for priority queue of shared_ptr<Node>
-struct BeamNodePtrComparator {
-    bool operator()(const std::shared_ptr<Node>& a, const std::shared_ptr<Node>& b) const {
-        // For min-heap, return true if a has HIGHER heuristic value (worse)
-        return a->getHeuristic() > b->getHeuristic();
-    }
+    int tieBreaking;  // TieBreaking among candidates of equal h
 };
 
 class BeamSearch {
@@ -41,24 +36,85 @@ class BeamSearch {
         BeamSearch(const BeamSearch& other);
         BeamSearch& operator=(const BeamSearch& other);
 
-        // Beam Search with memory limit and timeout
-        BeamSearchResult solve(Puzzle& puzzle, int size, int heuristic, bool silent = false, 
-                              size_t maxStates = 0, double maxTimeSeconds = 0, int beamWidth = 100);
+        // Beam Search with memory limit and timeout; each level's beam is
+        // expanded by up to threads workers
+        template <int N>
+        BeamSearchResult solve(Puzzle& puzzle, int heuristic, bool silent = false, 
+                              size_t maxStates = 0, double maxTimeSeconds = 0, int beamWidth = 100,
+                              int threads = 1, TieBreaking tieBreaking = TIE_HIGH_G);
+        
+        // Beam-stack search: beam search that comes back to the children it
+        // pruned, so it always finds a solution and proves the last one
+        // optimal when it completes. Driven by iterative widening: a run that
+        // spends its expansion budget is restarted with twice the width,
+        // keeping the best solution so far as the upper bound
+        template <int N>
+        BeamSearchResult solveBeamStack(Puzzle& puzzle, int heuristic, bool silent = false,
+                                        size_t maxStates = 0, double maxTimeSeconds = 0,
+                                        int beamWidth = 100);
         
         // Memory management
+        template <int N>
         static size_t estimateMemoryUsage(size_t numStates);
 
     private:
-        // Helper functions
-        struct Neighbor {
-            std::vector<uint8_t> state;
-            uint8_t zeroPos;
-            std::string action;
+        static constexpr size_t MIN_NODES_PER_THREAD = 256;  // Smaller beams are expanded serially
+
+        // Children generated by one worker, kept from level to level so the
+        // buffers are reused
+        template <int N>
+        struct Expansion {
+            std::vector<Node<N>> candidates;    // In generation order
+            std::vector<int> countByH;          // Candidates per h value
+            std::vector<int> rank;              // Scatter cursor per h value
         };
-        
-        void getNeighbors(const Node& node, std::vector<Neighbor>& neighbors);
-        bool isGoal(const std::vector<uint8_t>& state, 
-                   const std::vector<uint8_t>& goal);
+
+        static constexpr long long WIDENING_BUDGET = 16;        // Run budget: this * width * h(start) expansions
+        static constexpr long long TIME_CHECK_INTERVAL = 1024;  // Expansions between clock reads
+
+        enum RunOutcome {
+            RUN_COMPLETE,       // Every range explored: the upper bound is optimal
+            RUN_BUDGET_SPENT,
+            RUN_TIMEOUT,
+            RUN_MEMORY_LIMIT
+        };
+
+        // Order of the nodes of one level (all share g): f, then the board, so
+        // a prune point is never shared by a kept and a pruned node
+        template <int N>
+        struct LayerKey {
+            int f;
+            State<N> state;
+
+            bool operator<(const LayerKey& other) const;
+        };
+
+        // Beam-stack item of a level: only children with a key in [low, high)
+        // may enter the next level; high.f == INT_MAX stands for the upper bound
+        template <int N>
+        struct BeamStackItem {
+            LayerKey<N> low;
+            LayerKey<N> high;
+        };
+
+        // One beam-stack search of the given width. upperBound and path hold
+        // the best solution found so far and are improved in place
+        template <int N>
+        static RunOutcome beamStackRun(const State<N>& initial, uint8_t initialZeroPos, const State<N>& goal,
+                                       const Heuristic<N>& estimator, int beamWidth, long long budget,
+                                       size_t maxStates, std::chrono::high_resolution_clock::time_point startTime,
+                                       double maxTimeSeconds, int& upperBound, std::vector<uint8_t>& path,
+                                       long long& expanded, size_t& maxStored);
+
+        // Appends the children of beam[first, last) that are not in closedSet
+        template <int N>
+        static void expand(const std::vector<Node<N>>& beam, size_t first, size_t last,
+                           const StateTable<N, SearchEntry>& closedSet,
+                           const Heuristic<N>& estimator, Expansion<N>& expansion);
+
+        // Helper functions
+        template <int N>
+        bool isGoal(const State<N>& state, const State<N>& goal);
 };
 
 #endif
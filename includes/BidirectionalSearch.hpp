@@ -0,0 +1,78 @@
+#ifndef BIDIRECTIONALSEARCH_HPP
+#define BIDIRECTIONALSEARCH_HPP
+
+#include "Puzzle.hpp"
+#include "Node.hpp"
+#include "Heuristic.hpp"
+#include "Astar.hpp"
+#include "StateTable.hpp"
+#include "NodeArena.hpp"
+#include <algorithm>
+#include <queue>
+#include <string>
+#include <vector>
+#include <cstdint>
+
+// Comparator for the MM open lists: priority max(f, 2g), so neither search
+// goes past the middle of the solution before the other one catches up
+struct MeetInMiddleComparator {
+    template <int N>
+    static int priority(const Node<N>* node) {
+        return std::max(node->getFValue(), 2 * node->getCost());
+    }
+
+    template <int N>
+    bool operator()(const Node<N>* a, const Node<N>* b) const {
+        // For min-heap, return true if a has HIGHER priority value
+        return priority(a) > priority(b);
+    }
+};
+
+// Bidirectional MM: one search forward from the start toward the goal and one
+// backward from the goal toward the start, each guided by the heuristic of its
+// own target. Every generated state is looked up in the other search's table,
+// and the best meeting cost found is returned once no unexplored pair of
+// frontier states could join up more cheaply.
+class BidirectionalSearch {
+    public:
+        BidirectionalSearch();
+        ~BidirectionalSearch();
+        BidirectionalSearch(const BidirectionalSearch& other);
+        BidirectionalSearch& operator=(const BidirectionalSearch& other);
+
+        // MM with memory limit (states expanded by both searches) and timeout
+        template <int N>
+        AStarResult solve(Puzzle& puzzle, int heuristic, bool silent = false,
+                         size_t maxStates = 0, double maxTimeSeconds = 0);
+
+    private:
+        // One direction: its heuristic, table and open list, plus how many
+        // open nodes have each g and f so the smallest ones are known
+        template <int N>
+        struct Frontier {
+            Heuristic<N> estimator;
+            StateTable<N, SearchEntry> table;
+            std::priority_queue<Node<N>*, std::vector<Node<N>*>, MeetInMiddleComparator> open;
+            std::vector<int> openG;     // openG[g]: live open nodes with that g
+            std::vector<int> openF;     // openF[f]: live open nodes with that f
+            int minG;                   // No live open node below these
+            int minF;
+            int expanded;
+
+            Frontier(const std::vector<uint8_t>& target, int heuristic, size_t maxStates);
+        };
+
+        template <int N>
+        static void push(Frontier<N>& side, Node<N>* node);
+        template <int N>
+        static bool dropStale(Frontier<N>& side);
+        static int lowest(const std::vector<int>& counts, int& mark);
+
+        // Expands the best node of side; a path through a state the other
+        // side already reached lowers bestCost and moves meeting there
+        template <int N>
+        void expand(Frontier<N>& side, Frontier<N>& other, NodeArena<Node<N>>& nodes,
+                    int& bestCost, State<N>& meeting);
+};
+
+#endif
@@ -0,0 +1,71 @@
+#ifndef BOARD_HPP
+#define BOARD_HPP
+
+#include <array>
+#include <cstdint>
+
+// Board sizes the search engines are instantiated for
+#define NPUZZLE_MIN_SIZE 3
+#define NPUZZLE_MAX_SIZE 8
+#define NPUZZLE_FOR_EACH_SIZE(MACRO) MACRO(3) MACRO(4) MACRO(5) MACRO(6) MACRO(7) MACRO(8)
+
+// Blank moves, in the order neighbors are generated
+enum MoveDirection {
+    MOVE_UP = 0,
+    MOVE_DOWN = 1,
+    MOVE_LEFT = 2,
+    MOVE_RIGHT = 3
+};
+
+static constexpr int MOVE_COUNT = 4;
+
+template <int N>
+constexpr std::array<uint8_t, N * N> makeRowTable() {
+    std::array<uint8_t, N * N> rows{};
+    for (int i = 0; i < N * N; i++) {
+        rows[i] = static_cast<uint8_t>(i / N);
+    }
+    return rows;
+}
+
+template <int N>
+constexpr std::array<uint8_t, N * N> makeColTable() {
+    std::array<uint8_t, N * N> cols{};
+    for (int i = 0; i < N * N; i++) {
+        cols[i] = static_cast<uint8_t>(i % N);
+    }
+    return cols;
+}
+
+template <int N>
+constexpr std::array<std::array<int8_t, MOVE_COUNT>, N * N> makeNeighborTable() {
+    std::array<std::array<int8_t, MOVE_COUNT>, N * N> neighbors{};
+    for (int i = 0; i < N * N; i++) {
+        int row = i / N;
+        int col = i % N;
+        neighbors[i][MOVE_UP] = static_cast<int8_t>(row > 0 ? i - N : -1);
+        neighbors[i][MOVE_DOWN] = static_cast<int8_t>(row < N - 1 ? i + N : -1);
+        neighbors[i][MOVE_LEFT] = static_cast<int8_t>(col > 0 ? i - 1 : -1);
+        neighbors[i][MOVE_RIGHT] = static_cast<int8_t>(col < N - 1 ? i + 1 : -1);
+    }
+    return neighbors;
+}
+
+// Compile-time geometry of an N x N board: no division or modulo by a
+// runtime size is needed anywhere in the engines
+template <int N>
+struct Board {
+    static_assert(N >= NPUZZLE_MIN_SIZE && N <= NPUZZLE_MAX_SIZE, "unsupported board size");
+
+    static constexpr int SIZE = N;
+    static constexpr int CELLS = N * N;
+    static constexpr int NO_CELL = -1;
+
+    static constexpr std::array<uint8_t, CELLS> ROW = makeRowTable<N>();
+    static constexpr std::array<uint8_t, CELLS> COL = makeColTable<N>();
+
+    // NEIGHBORS[cell][direction] = cell the blank moves to, or NO_CELL
+    static constexpr std::array<std::array<int8_t, MOVE_COUNT>, CELLS> NEIGHBORS = makeNeighborTable<N>();
+};
+
+#endif
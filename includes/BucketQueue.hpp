@@ -0,0 +1,58 @@
+#ifndef BUCKETQUEUE_HPP
+#define BUCKETQUEUE_HPP
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+// Order among open nodes of equal f
+enum TieBreaking {
+    TIE_HIGH_G,         // Deepest first (closest to a goal)
+    TIE_LOW_H,          // Smallest h first
+    TIE_LIFO,           // Most recently pushed first
+    TIE_BREAKING_COUNT
+};
+
+// Display name of a TieBreaking ("high g", "low h", "LIFO"; "none" for -1,
+// the engines without an open list)
+std::string getTieBreakingName(int policy);
+
+// Open list for the best-first solvers, a drop-in for the binary heap.
+// f, g and h are small non-negative integers on the N-puzzle, so nodes are
+// kept in buckets indexed by f, then by the tie-breaking key (g, h, or none
+// for LIFO): push and pop are O(1) amortized and only touch the back of one
+// contiguous stack. Among equal keys the most recently pushed comes out first.
+// With f = g + h, high g and low h pick the same nodes; they differ from LIFO,
+// which ignores depth.
+// T is a pointer to a node type with getFValue(), getCost() and getHeuristic().
+template <typename T>
+class BucketQueue {
+    public:
+        explicit BucketQueue(TieBreaking policy = TIE_HIGH_G);
+        ~BucketQueue();
+        BucketQueue(const BucketQueue& other);
+        BucketQueue& operator=(const BucketQueue& other);
+
+        void push(T node);
+        const T& top() const;
+        void pop();
+
+        bool empty() const;
+        size_t size() const;
+        TieBreaking getTieBreaking() const;
+
+    private:
+        std::vector<std::vector<std::vector<T>>> _buckets;  // _buckets[f][key]: stack of nodes
+        std::vector<size_t> _counts;    // Nodes per f
+        std::vector<int> _next;         // Key popped next per f (meaningless when empty)
+        size_t _size;
+        int _minF;                      // Smallest non-empty f (any value when empty)
+        TieBreaking _policy;
+        bool _ascending;                // Smallest key first (low h) rather than largest
+
+        int key(T node) const;
+};
+
+#include "BucketQueue.tpp"
+
+#endif
@@ -0,0 +1,106 @@
+template <typename T>
+BucketQueue<T>::BucketQueue(TieBreaking policy)
+    : _buckets(), _counts(), _next(), _size(0), _minF(0), _policy(policy),
+      _ascending(policy == TIE_LOW_H) {}
+
+template <typename T>
+BucketQueue<T>::~BucketQueue() {}
+
+template <typename T>
+BucketQueue<T>::BucketQueue(const BucketQueue& other)
+    : _buckets(other._buckets), _counts(other._counts), _next(other._next),
+      _size(other._size), _minF(other._minF), _policy(other._policy),
+      _ascending(other._ascending) {}
+
+template <typename T>
+BucketQueue<T>& BucketQueue<T>::operator=(const BucketQueue& other) {
+    if (this != &other) {
+        _buckets = other._buckets;
+        _counts = other._counts;
+        _next = other._next;
+        _size = other._size;
+        _minF = other._minF;
+        _policy = other._policy;
+        _ascending = other._ascending;
+    }
+    return *this;
+}
+
+template <typename T>
+int BucketQueue<T>::key(T node) const {
+    switch (_policy) {
+        case TIE_LOW_H: return node->getHeuristic();
+        case TIE_LIFO: return 0;
+        default: return node->getCost();
+    }
+}
+
+template <typename T>
+void BucketQueue<T>::push(T node) {
+    int f = node->getFValue();
+    int k = key(node);
+
+    if (f >= static_cast<int>(_buckets.size())) {
+        _buckets.resize(f + 1);
+        _counts.resize(f + 1, 0);
+        _next.resize(f + 1, 0);
+    }
+    std::vector<std::vector<T>>& row = _buckets[f];
+    if (k >= static_cast<int>(row.size())) {
+        row.resize(k + 1);
+    }
+    row[k].push_back(node);
+
+    // Cursors only move toward the new node
+    if (_size == 0 || f < _minF) {
+        _minF = f;
+    }
+    if (_counts[f] == 0 || (_ascending ? k < _next[f] : k > _next[f])) {
+        _next[f] = k;
+    }
+    _counts[f]++;
+    _size++;
+}
+
+template <typename T>
+const T& BucketQueue<T>::top() const {
+    return _buckets[_minF][_next[_minF]].back();
+}
+
+template <typename T>
+void BucketQueue<T>::pop() {
+    std::vector<std::vector<T>>& row = _buckets[_minF];
+    row[_next[_minF]].pop_back();
+    _counts[_minF]--;
+    _size--;
+
+    // Move the cursors to the next node so top() stays a plain lookup
+    if (_counts[_minF] == 0) {
+        if (_size == 0) {
+            return;
+        }
+        while (_counts[_minF] == 0) {
+            _minF++;
+        }
+        return;
+    }
+    int step = _ascending ? 1 : -1;
+    while (row[_next[_minF]].empty()) {
+        _next[_minF] += step;
+    }
+}
+
+template <typename T>
+bool BucketQueue<T>::empty() const {
+    return _size == 0;
+}
+
+template <typename T>
+size_t BucketQueue<T>::size() const {
+    return _size;
+}
+
+template <typename T>
+TieBreaking BucketQueue<T>::getTieBreaking() const {
+    return _policy;
+}
@@ -0,0 +1,124 @@
+#ifndef COMMANDLINE_HPP
+#define COMMANDLINE_HPP
+
+#include "Puzzle.hpp"
+#include "BucketQueue.hpp"
+#include <atomic>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <vector>
+#include <cstdint>
+
+// Non-interactive front end: every choice the prompts of Display ask for is
+// given as a flag, one board is solved silently and a one-record report is
+// printed as text, JSON or CSV, so runs can be scripted and benchmarked.
+// A batch file is solved by a pool of jobs in one process, with a report of
+// all its boards in input order.
+class CommandLine {
+    public:
+        enum Format {
+            FORMAT_TEXT = 0,
+            FORMAT_JSON,
+            FORMAT_CSV
+        };
+
+        CommandLine();
+        ~CommandLine();
+        CommandLine(const CommandLine& other);
+        CommandLine& operator=(const CommandLine& other);
+
+        // Parses argv, solves the board and prints the report; returns the
+        // exit status (0 solved, 1 not solved, 2 bad arguments or input)
+        int run(int argc, char** argv);
+
+        static void printUsage(std::ostream& out, const char* program);
+
+    private:
+        struct Options {
+            int size;
+            bool sizeSet;
+            std::string file;           // Board file, "" to generate one
+            std::string batch;          // Board list solved by a pool of jobs, "" for one board
+            int jobs;
+            bool seeded;
+            unsigned int seed;
+            int iterations;
+            bool solvable;
+            int algorithm;              // Menu number of Display::promptForAlgorithm
+            int heuristic;              // -1 = default for the algorithm
+            double weight;              // 0 = default for the algorithm
+            int beamWidth;
+            int threads;                // 0 = default (all cores, 1 per board in a batch)
+            TieBreaking tieBreaking;
+            size_t memoryBudgetMB;
+            double maxTimeSeconds;
+            size_t maxStates;           // Per board
+            bool maxStatesSet;
+            Format format;
+            bool verbose;               // Let the solver print and log as in the game
+            bool help;
+        };
+
+        // The fields every engine result has in common
+        struct Report {
+            bool solved;
+            int moves;
+            int timeComplexity;
+            int spaceComplexity;
+            double executionTime;
+            std::string algorithmName;
+            std::string heuristicName;
+            bool memoryLimitReached;
+            std::string failureReason;
+        };
+
+        static constexpr const char* CSV_HEADER = "size,board,algorithm,heuristic,solved,moves,"
+                                                  "time_complexity,space_complexity,execution_time,"
+                                                  "memory_limit_reached,failure_reason";
+
+        bool parse(int argc, char** argv);
+        bool validate();
+        bool supportsHeuristic(int size) const;
+
+        // Boards of a file, one per line or in the subject layout (size line,
+        // then one row per line), several of them one after another
+        static bool readBoards(std::istream& in, const std::string& name,
+                               std::vector<std::vector<uint8_t>>& boards);
+        static bool loadBoards(const std::string& path, std::vector<std::vector<uint8_t>>& boards);
+
+        // Runs the chosen engine instantiated for an N x N board
+        template <int N>
+        Report runSolver(Puzzle& puzzle) const;
+        Report solve(Puzzle& puzzle) const;
+
+        // Job of the batch pool: solves boards[next++] until none are left
+        void solveBatch(const std::vector<std::vector<uint8_t>>& boards, std::vector<Report>& reports,
+                        std::atomic<size_t>& next) const;
+        int runBatch();
+
+        template <typename Result>
+        static Report toReport(const Result& result);
+
+        void printReport(const std::vector<uint8_t>& board, const Report& report) const;
+        void printBatch(const std::vector<std::vector<uint8_t>>& boards, const std::vector<Report>& reports,
+                        int jobs, double wallTime) const;
+        static int boardSize(const std::vector<uint8_t>& board);
+        static std::string jsonRecord(const std::vector<uint8_t>& board, const Report& report);
+        static std::string csvRecord(const std::vector<uint8_t>& board, const Report& report);
+
+        // Whole-string conversion of a flag value
+        template <typename T>
+        static bool parseValue(const std::string& text, T& value);
+
+        static bool parseAlgorithm(const std::string& name, int& algorithm);
+        static bool parseHeuristic(const std::string& name, int& heuristic);
+        static bool parseTieBreaking(const std::string& name, TieBreaking& tieBreaking);
+        static bool parseFormat(const std::string& name, Format& format);
+        static std::string jsonEscape(const std::string& text);
+        static std::string csvField(const std::string& text);
+
+        Options _options;
+};
+
+#endif
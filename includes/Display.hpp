@@ -16,9 +16,13 @@ class Display {
         std::vector<std::vector<int>> promptForCustomPuzzle(int size);
         bool promptSolvableOrUnsolvable();
         int promptForAlgorithm();
-        int promptForHeuristic(int algorithm);
-        double promptForWeight();
+        int promptForHeuristic(int algorithm, int size);
+        double promptForWeight(double defaultWeight = 1.5);
         int promptForBeamWidth();
+        int promptForThreads();
+        int promptForTieBreaking();
+        int promptForMemoryBudget();
+        int promptForPatternEncoding();
         int promptForIterations();
         bool displayRecap(int size, bool solvable, int iterations, 
                          const std::string& algorithmDescription, bool useCustom);
@@ -0,0 +1,41 @@
+#ifndef EPEASTAR_HPP
+#define EPEASTAR_HPP
+
+#include "Puzzle.hpp"
+#include "Node.hpp"
+#include "Heuristic.hpp"
+#include "Astar.hpp"
+#include "BucketQueue.hpp"
+#include <string>
+#include <vector>
+#include <cstdint>
+
+// Enhanced Partial Expansion A*: an expansion only generates the children
+// whose f equals the node's current f, then puts the node back in the open
+// list with the next f any of its children has. Children that A* would have
+// stored but never expanded (f above the solution cost) are never created.
+// For Manhattan and Hamming the f change of every move is read from an
+// operator-selection table, so the other children are not even evaluated;
+// the other heuristics evaluate every child and keep the matching ones.
+class EPEAstar {
+    public:
+        EPEAstar();
+        ~EPEAstar();
+        EPEAstar(const EPEAstar& other);
+        EPEAstar& operator=(const EPEAstar& other);
+
+        // EPEA* with memory limit and timeout
+        template <int N>
+        AStarResult solve(Puzzle& puzzle, int heuristic, bool silent = false,
+                         size_t maxStates = 0, double maxTimeSeconds = 0,
+                         TieBreaking tieBreaking = TIE_HIGH_G);
+
+    private:
+        // Operator-selection table: f change of moving the blank from a cell
+        // in a direction over a tile, indexed by (blank * MOVE_COUNT + move) *
+        // CELLS + tile; only filled for heuristics where isTileSum() holds
+        template <int N>
+        static std::vector<int8_t> buildOperatorTable(const Heuristic<N>& estimator);
+};
+
+#endif
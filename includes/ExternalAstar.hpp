@@ -0,0 +1,83 @@
+#ifndef EXTERNALASTAR_HPP
+#define EXTERNALASTAR_HPP
+
+#include "Puzzle.hpp"
+#include "Heuristic.hpp"
+#include "Astar.hpp"
+#include <fstream>
+#include <string>
+#include <vector>
+#include <cstdint>
+
+// External-memory search for instances whose states do not fit in RAM.
+// Breadth-first passes bounded by f = g + h, the bound raised as IDA* does,
+// with every BFS layer kept as a sorted file on disk instead of in a hash
+// table. The children of a layer are gathered in a buffer the size of the RAM
+// budget, sorted and written out as runs; the runs are then merged into the
+// next layer, dropping duplicates where they meet and every state of the
+// layer before (delayed duplicate detection: each move flips the blank's
+// parity, so a child already seen can only be in the previous layer). The
+// path is traced back through the layer files of the last pass.
+class ExternalAstar {
+    public:
+        static constexpr size_t DEFAULT_MEMORY_MB = 256;
+        static constexpr size_t MIN_MEMORY_MB = 16;
+
+        ExternalAstar();
+        ~ExternalAstar();
+        ExternalAstar(const ExternalAstar& other);
+        ExternalAstar& operator=(const ExternalAstar& other);
+
+        // External search with timeout and a RAM budget for its buffers; the
+        // layers go to a scratch directory under directory, removed on return
+        template <int N>
+        AStarResult solve(Puzzle& puzzle, int heuristic, bool silent = false,
+                         double maxTimeSeconds = 0, size_t memoryBudgetMB = DEFAULT_MEMORY_MB,
+                         const std::string& directory = "ddd");
+
+    private:
+        static constexpr uint8_t NO_MOVE = MOVE_COUNT;         // Move of the start record
+        static constexpr size_t MERGE_FAN_IN = 64;             // Runs merged at once
+        static constexpr size_t READ_BUFFER_RECORDS = 4096;    // Per open file
+        static constexpr long long TIME_CHECK_INTERVAL = 4096; // Expansions between clock reads
+
+        // One state of a layer file and the blank move that reached it
+        template <int N>
+        struct Record {
+            State<N> state;
+            uint8_t move;
+        };
+
+        // Buffered sequential reader of a run or layer file
+        template <int N>
+        struct RecordReader {
+            std::ifstream file;
+            std::vector<Record<N>> buffer;
+            size_t position;
+
+            RecordReader(const std::string& path, size_t bufferRecords);
+            bool next(Record<N>& record);
+        };
+
+        // Sorts records by state, drops repeated states and writes them to path
+        template <int N>
+        static bool writeRun(const std::string& path, std::vector<Record<N>>& records);
+
+        // Merges sorted inputs into output, one record per state, leaving out
+        // the states of exclude (a sorted layer, or "" for none); returns the
+        // number of records written
+        template <int N>
+        static size_t merge(const std::vector<std::string>& inputs, const std::string& exclude,
+                            const std::string& output, bool& ok);
+
+        // Binary search of a sorted layer file for state
+        template <int N>
+        static bool findRecord(const std::string& path, const State<N>& state, Record<N>& record);
+
+        // Creates directory if needed and a scratch directory of its own inside
+        static std::string makeScratchDirectory(const std::string& directory);
+        static std::string filePath(const std::string& directory, const char* kind, size_t index);
+        static size_t fileSize(const std::string& path);
+};
+
+#endif
@@ -0,0 +1,74 @@
+#ifndef FRONTIERASTAR_HPP
+#define FRONTIERASTAR_HPP
+
+#include "Puzzle.hpp"
+#include "Node.hpp"
+#include "Heuristic.hpp"
+#include "Astar.hpp"
+#include "BucketQueue.hpp"
+#include <chrono>
+#include <string>
+#include <vector>
+#include <cstdint>
+
+// Frontier A*: A* that keeps no closed list. Only open states are stored,
+// each with a bit per move telling which neighbors were already expanded;
+// those moves are never generated again, so a forgotten state cannot come
+// back (the heuristic has to be consistent for the result to stay optimal).
+// Nodes and table entries of expanded states are recycled, so the search
+// runs until the frontier, not every state seen, fills the memory budget.
+// Without parent moves the path is rebuilt by divide and conquer: every open
+// state also carries a relay, the last state on its path with g <= h, and
+// the start-relay and relay-goal halves are solved again the same way.
+class FrontierAstar {
+    public:
+        FrontierAstar();
+        ~FrontierAstar();
+        FrontierAstar(const FrontierAstar& other);
+        FrontierAstar& operator=(const FrontierAstar& other);
+
+        // Frontier A* with memory limit (states held at once) and timeout;
+        // the path is only rebuilt when it is displayed and logged
+        template <int N>
+        AStarResult solve(Puzzle& puzzle, int heuristic, bool silent = false,
+                         size_t maxStates = 0, double maxTimeSeconds = 0,
+                         TieBreaking tieBreaking = TIE_HIGH_G);
+
+    private:
+        // Table value of an open state
+        template <int N>
+        struct FrontierEntry {
+            int g;
+            uint8_t used;       // Bit per MoveDirection leading to an expanded neighbor
+            State<N> relay;     // Last state with g <= h on the best known path
+        };
+
+        template <int N>
+        struct Outcome {
+            bool found;
+            bool memoryLimitReached;
+            bool timedOut;
+            int cost;
+            State<N> relay;
+            int expanded;
+            int maxOpen;
+            size_t maxStored;   // Most states held at once (frontier table)
+        };
+
+        // One frontier search from start to target; maxTimeSeconds 0 = no limit
+        template <int N>
+        static Outcome<N> search(const State<N>& start, const State<N>& target,
+                                 const Heuristic<N>& estimator, size_t maxStates,
+                                 std::chrono::high_resolution_clock::time_point startTime,
+                                 double maxTimeSeconds, TieBreaking tieBreaking);
+
+        // Appends the moves of an optimal from-to path of length cost through
+        // relay, splitting both halves again until single moves are left
+        template <int N>
+        static void recoverPath(const State<N>& from, const State<N>& to, int cost,
+                                const State<N>& relay, const State<N>& goal, int heuristic,
+                                size_t maxStates, TieBreaking tieBreaking,
+                                std::vector<uint8_t>& path);
+};
+
+#endif
@@ -7,6 +7,13 @@
 #include "WeightedAstar.hpp"
 #include "Greedy.hpp"
 #include "BeamSearch.hpp"
+#include "IDAstar.hpp"
+#include "BidirectionalSearch.hpp"
+#include "HDAstar.hpp"
+#include "EPEAstar.hpp"
+#include "FrontierAstar.hpp"
+#include "ExternalAstar.hpp"
+#include "Puzzle.hpp"
 
 class Game {
     public:
@@ -16,25 +23,38 @@ class Game {
         Game& operator=(const Game& other);
 
         void gameLoop();
+
+        // Default limits for all algorithms (also used by the command line)
+        /*
+            ~50 bytes per state on a 4x4 board (arena node, open-list
+            pointer, state table slot; no parent chain is kept alive)
+            100mb = 2000000 states
+            200mb = 4000000 states
+            500mb = 10000000 states
+            1GB = 20000000 states
+            2GB = 40000000 states
+        */
+        static constexpr size_t DEFAULT_MAX_STATES = 20000000;   // 20 million states (~1GB)
+        static constexpr double DEFAULT_MAX_TIME = 60;        // 1 minute
     
     private:
+        // Runs the chosen engine instantiated for an N x N board
+        template <int N>
+        void runSolver(Puzzle& puzzle, int algorithm, int heuristic, double weight, int beamWidth,
+                       int threads, TieBreaking tieBreaking, size_t memoryBudgetMB);
+
         Display _display;
         Astar _astar;
         UCS _ucs;
         WeightedAstar _weightedAstar;
         Greedy _greedy;
         BeamSearch _beamSearch;
-        
-        // Default limits for all algorithms
-        /*
-            100mb = 1100000 states
-            200mb = 2200000 states
-            500mb = 5500000 states
-            1GB = 11000000 states
-            2GB = 22000000 states
-        */
-        static constexpr size_t DEFAULT_MAX_STATES = 10000000;   // 10 million states (~1GB)
-        static constexpr double DEFAULT_MAX_TIME = 60;        // 1 minute
+        IDAstar _idaStar;
+        BidirectionalSearch _bidirectional;
+        HDAstar _hdaStar;
+        EPEAstar _epeaStar;
+        FrontierAstar _frontierAstar;
+        ExternalAstar _externalAstar;
 };
 
 #endif
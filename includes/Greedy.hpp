@@ -9,7 +9,6 @@
 #include <string>
 #include <vector>
 #include <cstdint>
-#include <memory>
 #include <unordered_map>
 
 class Greedy {
@@ -20,20 +19,25 @@ class Greedy {
         Greedy& operator=(const Greedy& other);
 
         // Greedy Best-First Search (f(n) = h(n))
-        AStarResult solve(Puzzle& puzzle, int size, int heuristic, bool silent = false, 
-                         size_t maxStates = 0, double maxTimeSeconds = 0);
+        template <int N>
+        AStarResult solve(Puzzle& puzzle, int heuristic, bool silent = false, 
+                         size_t maxStates = 0, double maxTimeSeconds = 0,
+                         TieBreaking tieBreaking = TIE_HIGH_G);
 
     private:
         // Helper functions
+        template <int N>
         struct Neighbor {
-            std::vector<uint8_t> state;
+            State<N> state;
             uint8_t zeroPos;
-            std::string action;
+            uint8_t move;       // MoveDirection of the blank
         };
         
-        void getNeighbors(const Node& node, std::vector<Neighbor>& neighbors);
-        bool isGoal(const std::vector<uint8_t>& state, 
-                   const std::vector<uint8_t>& goal);
+        template <int N>
+        void getNeighbors(const Node<N>& node, std::vector<Neighbor<N>>& neighbors);
+        template <int N>
+        bool isGoal(const State<N>& state, const State<N>& goal);
+        template <int N>
         size_t estimateMemoryUsage(size_t numStates);
 };
 
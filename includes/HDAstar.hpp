@@ -0,0 +1,108 @@
+#ifndef HDASTAR_HPP
+#define HDASTAR_HPP
+
+#include "Puzzle.hpp"
+#include "Node.hpp"
+#include "Heuristic.hpp"
+#include "Astar.hpp"
+#include "StateTable.hpp"
+#include "NodeArena.hpp"
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <cstdint>
+
+// Hash-distributed A*: every state belongs to one worker thread, picked from
+// its hash. Each worker runs A* over its own states with its own open list,
+// table and node arena; children owned by another worker are batched and
+// posted to that worker's inbox. The best goal cost found so far prunes every
+// worker, and the search ends when all of them are idle with no batch in
+// flight - at that point no open node anywhere can beat it.
+class HDAstar {
+    public:
+        HDAstar();
+        ~HDAstar();
+        HDAstar(const HDAstar& other);
+        HDAstar& operator=(const HDAstar& other);
+
+        // HDA* with memory limit (states expanded by all workers) and timeout
+        template <int N>
+        AStarResult solve(Puzzle& puzzle, int heuristic, bool silent = false,
+                         size_t maxStates = 0, double maxTimeSeconds = 0, int threads = 1,
+                         TieBreaking tieBreaking = TIE_HIGH_G);
+
+    private:
+        static const size_t BATCH_SIZE = 64;            // Children per message batch
+        static const int EXPANSIONS_PER_ROUND = 256;    // Between inbox reads and flushes
+
+        // A child on its way to its owner, heuristic already evaluated
+        template <int N>
+        struct Message {
+            State<N> state;
+            uint8_t zeroPos;
+            uint8_t move;
+            int g;
+            int h;
+            HeuristicCache<N> cache;
+        };
+
+        template <int N>
+        struct Inbox {
+            std::mutex mutex;
+            std::vector<Message<N>> messages;
+        };
+
+        // State shared by all workers of one search
+        template <int N>
+        struct Shared {
+            const State<N>* goal;
+            const Heuristic<N>* estimator;
+            std::vector<Inbox<N>> inboxes;
+            std::atomic<int> bestCost;          // Cheapest goal reached so far
+            std::atomic<long long> active;      // Busy workers plus messages not yet received
+            std::atomic<long long> expanded;    // All workers, updated once per round
+            std::atomic<bool> stop;             // Limit reached
+            std::atomic<bool> memoryLimitReached;
+            std::chrono::high_resolution_clock::time_point startTime;
+            double maxTimeSeconds;
+            size_t maxStates;
+
+            explicit Shared(int threads);
+        };
+
+        template <int N>
+        struct Worker {
+            StateTable<N, SearchEntry> table;
+            NodeArena<Node<N>> nodes;
+            BucketQueue<Node<N>*> open;
+            std::vector<std::vector<Message<N>>> outboxes;   // One per destination
+            long long expanded;
+            int maxOpen;
+
+            Worker(size_t expectedStates, int threads, TieBreaking tieBreaking);
+        };
+
+        template <int N>
+        static size_t ownerOf(const State<N>& state, size_t workers);
+
+        template <int N>
+        static void run(Shared<N>& shared, Worker<N>& worker, size_t self);
+        template <int N>
+        static void receive(Shared<N>& shared, Worker<N>& worker, const Message<N>& message);
+        template <int N>
+        static void flush(Shared<N>& shared, Worker<N>& worker, size_t destination);
+        template <int N>
+        static bool hasOpenWork(Shared<N>& shared, Worker<N>& worker);
+        template <int N>
+        static void expand(Shared<N>& shared, Worker<N>& worker, size_t self);
+
+        // tracePath over the tables of every worker
+        template <int N>
+        static std::vector<uint8_t> tracePath(const std::vector<std::unique_ptr<Worker<N>>>& workers,
+                                              const State<N>& initial, const State<N>& goal);
+};
+
+#endif
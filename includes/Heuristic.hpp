@@ -1,39 +1,108 @@
 #ifndef HEURISTIC_HPP
 #define HEURISTIC_HPP
 
+#include "Board.hpp"
+#include "State.hpp"
+#include "PatternDatabase.hpp"
+#include "WalkingDistance.hpp"
+#include <array>
+#include <string>
 #include <vector>
 #include <cstdint>
 
 // Pre-computed goal positions for efficient heuristic calculation
+template <int N>
 struct GoalLookup {
-    std::vector<uint8_t> position;  // position[tile_value] = flat_index
-    std::vector<int> row;           // row[tile_value] = row_index
-    std::vector<int> col;           // col[tile_value] = col_index
+    std::array<uint8_t, N * N> position;  // position[tile_value] = flat_index
+    std::array<int, N * N> row;           // row[tile_value] = row_index
+    std::array<int, N * N> col;           // col[tile_value] = col_index
     
-    GoalLookup(const std::vector<uint8_t>& goal, int size);
+    GoalLookup();
+    explicit GoalLookup(const std::vector<uint8_t>& goal);
 };
 
+// Incremental heuristic state carried by every search node
+template <int N>
+struct HeuristicCache {
+    uint16_t distance;                          // Per-tile sum (Manhattan, or misplaced tiles for Hamming)
+    uint16_t conflicts;                         // Linear conflict pairs over all lines
+    std::array<uint8_t, 2 * N> lineConflicts;   // Pairs per row [0, N), then per column [N, 2N)
+    std::array<uint8_t, PatternDatabase::MAX_GROUPS> patternCosts;  // Per group, pattern database ids
+    uint32_t rowPattern;                        // Walking distance patterns, rows and columns
+    uint32_t colPattern;
+};
+
+// Display name of a heuristic id:
+// 0/4 = none, 1 = Manhattan, 2 = Hamming, 3 = Linear Conflict,
+// 5 = pattern database 5-5-5, 6 = pattern database 6-6-3 (4x4 only),
+// 7 = Walking Distance, 8 = max(Walking Distance, Linear Conflict) (up to 4x4)
+std::string getHeuristicName(int heuristic);
+
+template <int N>
 class Heuristic {
     public:
         Heuristic();
+        Heuristic(const std::vector<uint8_t>& goal, int heuristic);
         ~Heuristic();
         Heuristic(const Heuristic& other);
         Heuristic& operator=(const Heuristic& other);
 
+        // Shared estimator for a goal and heuristic id, built on first use and
+        // kept for the whole process so repeated solves (batches) skip the
+        // goal lookup and delta tables; safe to call from several threads
+        static const Heuristic& get(const std::vector<uint8_t>& goal, int heuristic);
+
+        // Incremental evaluation for the solvers. The cache holds the per-tile
+        // sum the heuristic is built on and, for Linear Conflict, the conflict
+        // count of every row and column; a child only recomputes what its move
+        // touched instead of the whole board.
+        int evaluate(const State<N>& state, HeuristicCache<N>& cache) const;
+
+        // Child reached by moving the blank from zeroPos in direction move:
+        // exactly one tile changed place, so only its distance and the two
+        // lines it moved between are updated
+        int evaluateMove(const State<N>& child, int zeroPos, int move,
+                         const HeuristicCache<N>& parent, HeuristicCache<N>& cache) const;
+
+        // Change in the per-tile sum when the blank moves from zeroPos in
+        // direction move over tile, without building the child. That is the
+        // whole change in h only when isTileSum() (Manhattan, Hamming, none).
+        int moveDelta(uint8_t tile, int zeroPos, int move) const;
+        bool isTileSum() const;
+
         // Optimized heuristic functions with pre-computed goal lookup
-        static int manhattanDistance(const std::vector<uint8_t>& state, 
-                                    const GoalLookup& goalLookup, int size);
-        static int hammingDistance(const std::vector<uint8_t>& state, 
-                                  const GoalLookup& goalLookup, int size);
-        static int linearConflict(const std::vector<uint8_t>& state, 
-                                 const GoalLookup& goalLookup, int size);
-        static int uninformedSearch(const std::vector<uint8_t>& state, 
-                                   const GoalLookup& goalLookup, int size);
+        static int manhattanDistance(const State<N>& state, const GoalLookup<N>& goalLookup);
+        static int hammingDistance(const State<N>& state, const GoalLookup<N>& goalLookup);
+        static int linearConflict(const State<N>& state, const GoalLookup<N>& goalLookup);
+        static int uninformedSearch(const State<N>& state, const GoalLookup<N>& goalLookup);
+        static int patternDatabase(const State<N>& state, const GoalLookup<N>& goalLookup, int heuristic);
+        static int walkingDistance(const State<N>& state, const GoalLookup<N>& goalLookup);
         
         // Get heuristic value based on choice
-        static int getHeuristicValue(const std::vector<uint8_t>& state,
-                                    const GoalLookup& goalLookup,
-                                    int size, int heuristic);
+        static int getHeuristicValue(const State<N>& state,
+                                    const GoalLookup<N>& goalLookup,
+                                    int heuristic);
+
+    private:
+        GoalLookup<N> _goalLookup;
+        int _heuristic;
+        const PatternDatabase* _patterns;   // Shared tables, 4x4 pattern database ids only
+        const WalkingDistance* _rowWalking; // Shared tables, walking distance ids only
+        const WalkingDistance* _colWalking;
+
+        // _delta[tile][from][direction]: change in distance when tile slides
+        // out of cell from in direction (MoveDirection); 0 for impossible slides
+        std::array<std::array<std::array<int8_t, MOVE_COUNT>, N * N>, N * N> _delta;
+
+        static int linearConflictCount(const State<N>& state, const GoalLookup<N>& goalLookup);
+        static int rowConflicts(const State<N>& state, const GoalLookup<N>& goalLookup, int row);
+        static int colConflicts(const State<N>& state, const GoalLookup<N>& goalLookup, int col);
+        int tileDistance(uint8_t tile, int cell) const;
+        static void locateTiles(const State<N>& state, uint8_t* cellOf);
+        static int walkingPatterns(const State<N>& state, const GoalLookup<N>& goalLookup,
+                                   const WalkingDistance& rows, const WalkingDistance& cols,
+                                   uint32_t& rowPattern, uint32_t& colPattern);
+        void buildDeltaTable();
 };
 
 #endif
@@ -0,0 +1,94 @@
+#ifndef IDASTAR_HPP
+#define IDASTAR_HPP
+
+#include "Puzzle.hpp"
+#include "Heuristic.hpp"
+#include "Astar.hpp"
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <cstdint>
+
+// Iterative deepening A*: depth-first searches bounded by f = g + h, the bound
+// raised to the smallest f that exceeded it after each pass. One board is
+// slid in place and every move undone on the way back, so memory is the move
+// stack and one heuristic cache per depth - nothing is stored per state.
+// With several threads the tree is split a few levels below the start into
+// work items; a pool of workers searches them under each bound, stealing
+// from each other's queues, and all stop as soon as one finds the goal.
+class IDAstar {
+    public:
+        IDAstar();
+        ~IDAstar();
+        IDAstar(const IDAstar& other);
+        IDAstar& operator=(const IDAstar& other);
+
+        // IDA* with timeout (no state limit: memory is O(solution depth)),
+        // searched by threads workers (1 = sequential)
+        template <int N>
+        AStarResult solve(Puzzle& puzzle, int heuristic, bool silent = false,
+                         double maxTimeSeconds = 0, int threads = 1);
+
+    private:
+        static const int FOUND = -1;
+        static const int ABORTED = -2;
+        static const long long TIME_CHECK_INTERVAL = 65536;   // Expansions between clock reads
+        static const size_t WORK_ITEMS_PER_THREAD = 32;         // Split until each worker has this many
+
+        template <int N>
+        struct SearchContext {
+            State<N> state;                         // Board at the current depth, mutated in place
+            int zeroPos;
+            const State<N>* goal;
+            const Heuristic<N>* estimator;
+            std::vector<uint8_t> path;              // Blank moves from the start
+            std::vector<HeuristicCache<N>> caches;  // caches[g]: heuristic parts of the board at depth g
+            long long expanded;
+            int maxDepth;
+            std::chrono::high_resolution_clock::time_point startTime;
+            double maxTimeSeconds;
+            const std::atomic<bool>* stop;          // Raised when another worker ends the pass
+            bool timedOut;
+        };
+
+        // Subtree root at the split depth, searched whole by one worker
+        template <int N>
+        struct WorkItem {
+            State<N> state;
+            int zeroPos;
+            int g;
+            int h;
+            std::vector<uint8_t> path;
+            HeuristicCache<N> cache;
+        };
+
+        // Work item indices of one worker: the owner takes from the front,
+        // thieves from the back
+        struct WorkQueue {
+            std::mutex mutex;
+            std::deque<size_t> items;
+        };
+
+        // Depth-first pass under bound: FOUND, ABORTED (timeout), or the
+        // smallest f that exceeded bound (INT_MAX when nothing did)
+        template <int N>
+        int search(SearchContext<N>& context, int g, int h, int bound);
+
+        // Expands the start breadth-first until there are at least minItems
+        // subtrees; true (path in root) if the goal turned up on the way
+        template <int N>
+        bool split(SearchContext<N>& root, int initialH, size_t minItems,
+                   std::vector<WorkItem<N>>& items);
+
+        // One pass of the worker pool over items: same results as search
+        template <int N>
+        int searchParallel(SearchContext<N>& root, const std::vector<WorkItem<N>>& items,
+                           std::vector<SearchContext<N>>& workers, int bound);
+
+        static bool takeItem(std::vector<WorkQueue>& queues, size_t worker, size_t& index);
+};
+
+#endif
@@ -1,52 +1,60 @@
 #ifndef NODE_HPP
 #define NODE_HPP
 
+#include "State.hpp"
+#include "Heuristic.hpp"
 #include <vector>
-#include <string>
-#include <memory>
 #include <cstdint>
 
+template <int N>
 class Node {
     public:
         Node();
-        Node(const std::vector<uint8_t>& state,
-             int size,
+        Node(const State<N>& state,
              uint8_t zeroPos,
              int cost,
              int heuristic,
-             std::shared_ptr<Node> parent = nullptr,
-             const std::string& action = "");
-        ~Node();
-        Node(const Node& other);
-        Node& operator=(const Node& other);
+             const HeuristicCache<N>& cache = HeuristicCache<N>(),
+             uint8_t move = MOVE_UP);
+        ~Node() = default;
+        Node(const Node& other) = default;
+        Node& operator=(const Node& other) = default;
 
         // Comparison operators for priority queue
         bool operator<(const Node& other) const;
         bool operator>(const Node& other) const;
 
         // Getters
-        const std::vector<uint8_t>& getState() const;
+        const State<N>& getState() const;
         int getSize() const;
         uint8_t getZeroPos() const;
         int getCost() const;
         int getHeuristic() const;
+        const HeuristicCache<N>& getHeuristicCache() const;
         int getFValue() const;
-        std::shared_ptr<Node> getParent() const;
-        const std::string& getAction() const;
+        uint8_t getMove() const;
+        int getDeltaF() const;
+
+        // EPEA*: the node goes back to the open list with its f raised by
+        // deltaF until every child has been generated
+        void setDeltaF(int deltaF);
 
         // Hash function for closed set
         size_t hash() const;
 
     private:
-        std::vector<uint8_t> _state;  // Flat array representation
-        int _size;                     // Grid dimension (e.g., 3 for 3x3)
+        State<N> _state;               // Packed board (one word for boards up to 4x4)
         uint8_t _zeroPos;              // Position of blank tile (0-based flat index)
+        uint8_t _move;                 // Blank move that generated this node (unused for the start)
+        uint8_t _deltaF;               // Added to g + h in getFValue(), 0 outside EPEA*
         int _cost;       // g(n) - cost from start
         int _heuristic;  // h(n) - heuristic estimate
-        
-        // Optional path tracking (only used when logging moves to file)
-        std::shared_ptr<Node> _parent;  // Parent node for path reconstruction
-        std::string _action;            // Action that led to this state
+        HeuristicCache<N> _cache;      // Parts of h updated incrementally by the children
+
+        // No parent link: the path is rebuilt from the moves recorded in the
+        // search's state table, so expanded nodes can be forgotten
 };
 
+#include "Node.tpp"
+
 #endif
@@ -0,0 +1,79 @@
+template <int N>
+Node<N>::Node() : _zeroPos(0), _move(MOVE_UP), _deltaF(0), _cost(0), _heuristic(0), _cache() {}
+
+template <int N>
+Node<N>::Node(const State<N>& state,
+              uint8_t zeroPos,
+              int cost,
+              int heuristic,
+              const HeuristicCache<N>& cache,
+              uint8_t move)
+    : _state(state), _zeroPos(zeroPos), _move(move), _deltaF(0),
+      _cost(cost), _heuristic(heuristic), _cache(cache) {}
+
+template <int N>
+bool Node<N>::operator<(const Node& other) const {
+    // For max heap (priority queue uses max heap by default)
+    // We want min heap, so reverse the comparison
+    return getFValue() > other.getFValue();
+}
+
+template <int N>
+bool Node<N>::operator>(const Node& other) const {
+    return getFValue() < other.getFValue();
+}
+
+template <int N>
+const State<N>& Node<N>::getState() const {
+    return _state;
+}
+
+template <int N>
+int Node<N>::getSize() const {
+    return N;
+}
+
+template <int N>
+uint8_t Node<N>::getZeroPos() const {
+    return _zeroPos;
+}
+
+template <int N>
+int Node<N>::getCost() const {
+    return _cost;
+}
+
+template <int N>
+int Node<N>::getHeuristic() const {
+    return _heuristic;
+}
+
+template <int N>
+const HeuristicCache<N>& Node<N>::getHeuristicCache() const {
+    return _cache;
+}
+
+template <int N>
+int Node<N>::getFValue() const {
+    return _cost + _heuristic + _deltaF;
+}
+
+template <int N>
+uint8_t Node<N>::getMove() const {
+    return _move;
+}
+
+template <int N>
+int Node<N>::getDeltaF() const {
+    return _deltaF;
+}
+
+template <int N>
+void Node<N>::setDeltaF(int deltaF) {
+    _deltaF = static_cast<uint8_t>(deltaF);
+}
+
+template <int N>
+size_t Node<N>::hash() const {
+    return _state.hash();
+}
@@ -0,0 +1,54 @@
+#ifndef NODEARENA_HPP
+#define NODEARENA_HPP
+
+#include <cstddef>
+#include <vector>
+#include <type_traits>
+
+// Per-search slab allocator for search nodes.
+// Objects are bump-allocated out of fixed-size blocks and never freed one by
+// one: the whole arena is released when it goes out of scope (end of solve()).
+// A search that forgets nodes (frontier search) can hand their slots back for
+// reuse with release().
+// T must be trivially destructible, so teardown is one free() per block no
+// matter how many nodes were created.
+template <typename T>
+class NodeArena {
+    static_assert(std::is_trivially_destructible<T>::value,
+                  "NodeArena never runs destructors");
+
+    public:
+        static constexpr size_t DEFAULT_BLOCK_SIZE = 65536;  // Objects per block
+
+        explicit NodeArena(size_t blockSize = DEFAULT_BLOCK_SIZE);
+        ~NodeArena();
+
+        // Construct a T in the arena; the pointer stays valid until the arena dies
+        template <typename... Args>
+        T* create(Args&&... args);
+
+        // Hand object's slot to the next create(); object must not be used again
+        void release(T* object);
+
+        // Drop every object but keep the first block for reuse
+        void reset();
+
+        size_t size() const;
+        size_t memoryUsage() const;
+
+    private:
+        NodeArena(const NodeArena& other);             // Not copyable: owns raw blocks
+        NodeArena& operator=(const NodeArena& other);
+
+        std::vector<T*> _blocks;
+        size_t _blockSize;
+        size_t _used;           // Objects handed out from the last block
+        size_t _count;          // Live objects
+        std::vector<T*> _free;  // Released slots, reused first
+
+        void addBlock();
+};
+
+#include "NodeArena.tpp"
+
+#endif
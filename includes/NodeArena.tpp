@@ -0,0 +1,72 @@
+#include <cstdlib>
+#include <new>
+#include <utility>
+
+template <typename T>
+NodeArena<T>::NodeArena(size_t blockSize)
+    : _blockSize(blockSize > 0 ? blockSize : 1), _used(0), _count(0) {
+    addBlock();
+}
+
+template <typename T>
+NodeArena<T>::~NodeArena() {
+    for (T* block : _blocks) {
+        std::free(block);
+    }
+}
+
+template <typename T>
+void NodeArena<T>::addBlock() {
+    // Raw storage: pages are only touched as objects are bump-allocated
+    T* block = static_cast<T*>(std::malloc(_blockSize * sizeof(T)));
+    if (!block) {
+        throw std::bad_alloc();
+    }
+    _blocks.push_back(block);
+    _used = 0;
+}
+
+template <typename T>
+template <typename... Args>
+T* NodeArena<T>::create(Args&&... args) {
+    if (!_free.empty()) {
+        T* object = new (_free.back()) T(std::forward<Args>(args)...);
+        _free.pop_back();
+        _count++;
+        return object;
+    }
+    if (_used == _blockSize) {
+        addBlock();
+    }
+    T* object = new (_blocks.back() + _used) T(std::forward<Args>(args)...);
+    _used++;
+    _count++;
+    return object;
+}
+
+template <typename T>
+void NodeArena<T>::release(T* object) {
+    _free.push_back(object);
+    _count--;
+}
+
+template <typename T>
+void NodeArena<T>::reset() {
+    for (size_t i = 1; i < _blocks.size(); i++) {
+        std::free(_blocks[i]);
+    }
+    _blocks.resize(1);
+    _free.clear();
+    _used = 0;
+    _count = 0;
+}
+
+template <typename T>
+size_t NodeArena<T>::size() const {
+    return _count;
+}
+
+template <typename T>
+size_t NodeArena<T>::memoryUsage() const {
+    return _blocks.size() * _blockSize * sizeof(T);
+}
@@ -0,0 +1,151 @@
+#ifndef PATTERNDATABASE_HPP
+#define PATTERNDATABASE_HPP
+
+#include <array>
+#include <memory>
+#include <string>
+#include <vector>
+#include <cstdint>
+
+// Additive disjoint pattern databases for the 4x4 board.
+// The 15 tiles are split into disjoint groups; for each group a table holds
+// the exact number of moves of *that group's* tiles needed to bring them home
+// (other tiles are indistinguishable, their moves are free). Because no move is
+// counted by two groups, the per-group costs add up to an admissible heuristic
+// that dominates Manhattan distance.
+//
+// Tables can be generated once into pdb/ (make pdb) and are then memory-mapped
+// read-only on first use instead of being rebuilt: pages are faulted in as the
+// search touches them. Without a matching file the tables are built in memory.
+//
+// Storage encodings (cost per entry, entries = tile cells + blank cell):
+//   byte       8 bits, exact
+//   nibble     4 bits: (cost - group Manhattan) / 2, exact up to 30 extra moves
+//   mod3       2 bits: cost mod 3, rebuilt from a neighbour's known cost
+//   min-blank  8 bits per tile placement, minimum over every blank cell;
+//              16x smaller than byte but weaker and not consistent
+class PatternDatabase {
+    public:
+        static constexpr int SIZE = 4;
+        static constexpr int CELLS = SIZE * SIZE;
+        static constexpr int MAX_GROUPS = 3;
+        static constexpr uint32_t FILE_VERSION = 2;
+
+        enum Encoding {
+            ENCODING_BYTE = 0,
+            ENCODING_NIBBLE,
+            ENCODING_MOD3,
+            ENCODING_MIN_BLANK,
+            ENCODING_COUNT
+        };
+
+        PatternDatabase();
+        // Build the tables for goal, one group per entry of groups (tile values)
+        PatternDatabase(const std::vector<uint8_t>& goal,
+                        const std::vector<std::vector<uint8_t>>& groups,
+                        Encoding encoding);
+        ~PatternDatabase();
+        PatternDatabase(const PatternDatabase& other);
+        PatternDatabase& operator=(const PatternDatabase& other);
+
+        // Heuristic ids backed by a pattern database (5 = 5-5-5, 6 = 6-6-3)
+        static bool isPatternHeuristic(int heuristic);
+
+        // Encoding used by get() and generateFiles() (default: nibble)
+        static void setEncoding(Encoding encoding);
+        static Encoding getEncoding();
+        static const char* getEncodingName(Encoding encoding);
+        static bool parseEncoding(const std::string& name, Encoding& encoding);
+
+        // Shared database for a goal, heuristic id and the current encoding:
+        // mapped from its file if one matches, otherwise built, on first use
+        static const PatternDatabase& get(const std::vector<uint8_t>& goal, int heuristic);
+
+        // Build every database for goal in the current encoding and write it under pdb/
+        static bool generateFiles(const std::vector<uint8_t>& goal);
+
+        // pdb/<size>x<size>-<partition>-<encoding>-<goal tiles in hex>.pdb
+        static std::string filePath(const std::vector<uint8_t>& goal, int heuristic,
+                                    Encoding encoding);
+
+        bool save(const std::string& path, const std::vector<uint8_t>& goal) const;
+
+        // Map path read-only; false if it is missing or was written for
+        // another version, goal, partition or encoding
+        bool load(const std::string& path, const std::vector<uint8_t>& goal,
+                  const std::vector<std::vector<uint8_t>>& groups, Encoding encoding);
+
+        int getGroupCount() const;
+        int getGroup(uint8_t tile) const;   // Group of tile, -1 for the blank
+        Encoding getStorageEncoding() const;
+        size_t memoryUsage() const;         // Bytes of table storage
+
+        // Cost of one group; cellOf[tile] = cell currently holding tile
+        // (cellOf[0] = blank). mod3 finds it by walking down to the goal.
+        int groupCost(int group, const uint8_t* cellOf) const;
+
+        // Same, for a position one move away from one whose group cost is
+        // known: mod3 only has to pick among knownCost - 1, knownCost, knownCost + 1
+        int groupCostAfterMove(int group, const uint8_t* cellOf, int knownCost) const;
+
+        // Sum over all groups
+        int totalCost(const uint8_t* cellOf) const;
+
+    private:
+        struct Group {
+            std::vector<uint8_t> tiles;
+            const uint8_t* costs;                   // Encoded, indexed by rank() of the cells
+            std::shared_ptr<const uint8_t> storage; // Owns costs: heap buffer or file mapping
+        };
+
+        // On-disk layout: this header, then each group's table in group order
+        struct FileHeader {
+            char magic[4];                          // "NPDB"
+            uint32_t version;
+            uint32_t boardSize;
+            uint32_t encoding;
+            uint32_t groupCount;
+            uint8_t goal[CELLS];
+            uint8_t groupSizes[MAX_GROUPS];
+            uint8_t tiles[MAX_GROUPS][CELLS];
+        };
+
+        static constexpr uint8_t UNVISITED = 0xFF;
+        static constexpr int MAX_NIBBLE = 0xF;
+        static constexpr uint32_t ALL_CELLS = (1u << CELLS) - 1;
+        static constexpr uint32_t FIRST_COLUMN = 0x1111;   // Cell masks, bit i = cell i
+        static constexpr uint32_t LAST_COLUMN = 0x8888;
+
+        static Encoding _encoding;
+
+        std::vector<Group> _groups;
+        std::array<int8_t, CELLS> _groupOf;
+        Encoding _storageEncoding;
+        // _distance[tile][cell]: Manhattan distance of tile from its goal cell
+        std::array<std::array<uint8_t, CELLS>, CELLS> _distance;
+
+        static std::vector<std::vector<uint8_t>> partitionFor(int heuristic);
+        static FileHeader makeHeader(const std::vector<uint8_t>& goal,
+                                     const std::vector<std::vector<uint8_t>>& groups,
+                                     Encoding encoding);
+        void buildDistances(const std::vector<uint8_t>& goal);
+
+        void build(Group& group, const std::vector<uint8_t>& goal);
+
+        // Raw stored value for the group's tiles at cells with the blank at blank
+        int storedValue(const Group& group, const uint8_t* cells, int blank) const;
+        int groupDistance(const Group& group, const uint8_t* cells) const;
+        // mod3: number of group moves from cells/blank down to the goal placement
+        int descend(const Group& group, uint8_t* cells, int blank) const;
+
+        // Cells the blank reaches from region without moving a group tile
+        static uint32_t floodBlank(uint32_t region, uint32_t freeCells);
+
+        // Ranking of k distinct cells (in tile order) into [0, 16! / (16 - k)!)
+        static uint64_t rank(const uint8_t* cells, int count);
+        static uint64_t pack(const uint8_t* cells, int count, int regionCell);
+        static uint64_t tableSize(int count);
+        static uint64_t storageSize(int count, Encoding encoding);
+};
+
+#endif
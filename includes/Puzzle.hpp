@@ -12,6 +12,7 @@ class Puzzle {
         Puzzle& operator=(const Puzzle& other);
 
         void generatePuzzle();
+        void generatePuzzle(unsigned int seed);
         const std::vector<uint8_t>& getGrid() const;
         void setGrid(const std::vector<uint8_t>& grid);
         void setGridFrom2D(const std::vector<std::vector<int>>& grid);  // For compatibility
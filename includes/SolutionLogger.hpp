@@ -1,10 +1,9 @@
 #ifndef SOLUTIONLOGGER_HPP
 #define SOLUTIONLOGGER_HPP
 
-#include "Node.hpp"
+#include "Board.hpp"
 #include <string>
 #include <vector>
-#include <memory>
 #include <cstdint>
 
 class SolutionLogger {
@@ -19,7 +18,7 @@ class SolutionLogger {
             const std::vector<uint8_t>& initialState,
             const std::vector<uint8_t>& goalState,
             int size,
-            std::shared_ptr<Node> goalNode,
+            const std::vector<uint8_t>& path,   // Blank moves (MoveDirection) from the initial state
             int moves,
             int timeComplexity,
             int spaceComplexity,
@@ -48,8 +47,8 @@ class SolutionLogger {
         // Helper to generate unique filename with timestamp
         static std::string generateFilename(const std::string& algorithmName, bool success);
         
-        // Helper to reconstruct path from goal node
-        static std::vector<std::shared_ptr<Node>> reconstructPath(std::shared_ptr<Node> goalNode);
+        // Helper to slide the blank one step on a flat board
+        static void applyMove(std::vector<uint8_t>& state, int size, int move);
         
         // Helper to ensure results directory exists
         static void ensureResultsDirectory();
@@ -0,0 +1,77 @@
+#ifndef STATE_HPP
+#define STATE_HPP
+
+#include "Board.hpp"
+#include <array>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+// Board contents used by the search engines, specialised per board size.
+// Boards of up to 16 cells (3x3, 4x4) are packed 4 bits per tile into a single
+// 64-bit word: moves are shifts and masks, equality and hashing are one-word
+// operations. Larger boards use a fixed-size array of one byte per tile.
+// Copies are defaulted so State stays trivially copyable; the all-zero board
+// (what the default constructor builds) is never a valid position.
+template <int N, bool Packed = (N * N <= 16)>
+class State;
+
+// Packed representation: cell i lives in bits [4i, 4i + 4)
+template <int N>
+class State<N, true> {
+    public:
+        State();
+        explicit State(const std::vector<uint8_t>& tiles);
+        ~State() = default;
+        State(const State& other) = default;
+        State& operator=(const State& other) = default;
+
+        bool operator==(const State& other) const;
+        bool operator!=(const State& other) const;
+        bool operator<(const State& other) const;
+
+        // Tile value at flat index (0 = blank)
+        uint8_t get(int index) const;
+        void set(int index, uint8_t tile);
+
+        // Slide the tile at tilePos into the blank at zeroPos
+        void slide(int zeroPos, int tilePos);
+
+        size_t hash() const;
+        std::vector<uint8_t> toVector() const;
+
+    private:
+        static constexpr int BITS_PER_TILE = 4;
+        static constexpr uint64_t TILE_MASK = 0xF;
+
+        uint64_t _packed;
+};
+
+// Byte-per-tile representation for 5x5 and larger boards
+template <int N>
+class State<N, false> {
+    public:
+        State();
+        explicit State(const std::vector<uint8_t>& tiles);
+        ~State() = default;
+        State(const State& other) = default;
+        State& operator=(const State& other) = default;
+
+        bool operator==(const State& other) const;
+        bool operator!=(const State& other) const;
+        bool operator<(const State& other) const;
+
+        uint8_t get(int index) const;
+        void set(int index, uint8_t tile);
+        void slide(int zeroPos, int tilePos);
+
+        size_t hash() const;
+        std::vector<uint8_t> toVector() const;
+
+    private:
+        std::array<uint8_t, N * N> _tiles;
+};
+
+#include "State.tpp"
+
+#endif
@@ -0,0 +1,139 @@
+#include <cstring>
+#include <utility>
+
+// 64-bit finalizer (MurmurHash3 fmix64), spreads every input bit over the result
+inline uint64_t mixState64(uint64_t h) {
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb3fe1a85ec53ULL;
+    h ^= h >> 33;
+    return h;
+}
+
+// ---------------------------------------------------------------------------
+// Packed representation (3x3, 4x4)
+// ---------------------------------------------------------------------------
+
+template <int N>
+State<N, true>::State() : _packed(0) {}
+
+template <int N>
+State<N, true>::State(const std::vector<uint8_t>& tiles) : _packed(0) {
+    for (int i = 0; i < N * N; i++) {
+        _packed |= static_cast<uint64_t>(tiles[i]) << (i * BITS_PER_TILE);
+    }
+}
+
+template <int N>
+bool State<N, true>::operator==(const State& other) const {
+    return _packed == other._packed;
+}
+
+template <int N>
+bool State<N, true>::operator!=(const State& other) const {
+    return _packed != other._packed;
+}
+
+template <int N>
+bool State<N, true>::operator<(const State& other) const {
+    return _packed < other._packed;
+}
+
+template <int N>
+uint8_t State<N, true>::get(int index) const {
+    return static_cast<uint8_t>((_packed >> (index * BITS_PER_TILE)) & TILE_MASK);
+}
+
+template <int N>
+void State<N, true>::set(int index, uint8_t tile) {
+    int shift = index * BITS_PER_TILE;
+    _packed = (_packed & ~(TILE_MASK << shift)) | (static_cast<uint64_t>(tile) << shift);
+}
+
+template <int N>
+void State<N, true>::slide(int zeroPos, int tilePos) {
+    // The blank is 0, so the tile nibble is simply moved over
+    int tileShift = tilePos * BITS_PER_TILE;
+    uint64_t tile = (_packed >> tileShift) & TILE_MASK;
+    _packed &= ~(TILE_MASK << tileShift);
+    _packed |= tile << (zeroPos * BITS_PER_TILE);
+}
+
+template <int N>
+size_t State<N, true>::hash() const {
+    return static_cast<size_t>(mixState64(_packed));
+}
+
+template <int N>
+std::vector<uint8_t> State<N, true>::toVector() const {
+    std::vector<uint8_t> tiles(N * N);
+    for (int i = 0; i < N * N; i++) {
+        tiles[i] = get(i);
+    }
+    return tiles;
+}
+
+// ---------------------------------------------------------------------------
+// Byte-per-tile representation (5x5 and up)
+// ---------------------------------------------------------------------------
+
+template <int N>
+State<N, false>::State() : _tiles() {}
+
+template <int N>
+State<N, false>::State(const std::vector<uint8_t>& tiles) {
+    std::memcpy(_tiles.data(), tiles.data(), N * N);
+}
+
+template <int N>
+bool State<N, false>::operator==(const State& other) const {
+    return _tiles == other._tiles;
+}
+
+template <int N>
+bool State<N, false>::operator!=(const State& other) const {
+    return _tiles != other._tiles;
+}
+
+template <int N>
+bool State<N, false>::operator<(const State& other) const {
+    return std::memcmp(_tiles.data(), other._tiles.data(), N * N) < 0;
+}
+
+template <int N>
+uint8_t State<N, false>::get(int index) const {
+    return _tiles[index];
+}
+
+template <int N>
+void State<N, false>::set(int index, uint8_t tile) {
+    _tiles[index] = tile;
+}
+
+template <int N>
+void State<N, false>::slide(int zeroPos, int tilePos) {
+    std::swap(_tiles[zeroPos], _tiles[tilePos]);
+}
+
+template <int N>
+size_t State<N, false>::hash() const {
+    // Fold the board 8 bytes at a time, then finalize
+    uint64_t h = 0x9e3779b97f4a7c15ULL;
+    int i = 0;
+    for (; i + 8 <= N * N; i += 8) {
+        uint64_t word;
+        std::memcpy(&word, _tiles.data() + i, 8);
+        h = (h ^ word) * 0x100000001b3ULL;
+        h ^= h >> 29;
+    }
+    uint64_t tail = 0;
+    std::memcpy(&tail, _tiles.data() + i, N * N - i);
+    h = (h ^ tail) * 0x100000001b3ULL;
+    return static_cast<size_t>(mixState64(h));
+}
+
+template <int N>
+std::vector<uint8_t> State<N, false>::toVector() const {
+    return std::vector<uint8_t>(_tiles.begin(), _tiles.end());
+}
@@ -0,0 +1,97 @@
+#ifndef STATETABLE_HPP
+#define STATETABLE_HPP
+
+#include "State.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Per-state bookkeeping shared by the best-first solvers.
+// The move that reached the state is all that is kept of the path: nodes carry
+// no parent pointer, the solution is rebuilt from the table (see tracePath).
+struct SearchEntry {
+    int g;              // Best known path cost to the state
+    uint8_t closed : 1; // Already expanded
+    uint8_t move : 2;   // MoveDirection of the blank on the best known path
+};
+
+// Cap on what every StateTable preallocates, shared by all board sizes. The
+// default suits one search per process, which then rarely rehashes; a batch
+// of small searches lowers it, as faulting in the pages of a mostly empty
+// table costs more than such a search. Set it before any search starts.
+struct StateTablePreallocation {
+    static constexpr size_t DEFAULT_BYTES = static_cast<size_t>(64) << 20;
+    static constexpr size_t BATCH_BYTES = 0;   // Start at MIN_CAPACITY, double on demand
+    static inline size_t bytes = DEFAULT_BYTES;
+};
+
+// Open-addressing hash table keyed by the full board.
+// Slots are stored inline (no per-entry allocation, no pointer chase) and
+// probed linearly; the all-zero board marks an empty slot. Value must be
+// trivially copyable; new entries start value-initialized.
+template <int N, typename Value>
+class StateTable {
+    public:
+        static constexpr double DEFAULT_MAX_LOAD_FACTOR = 0.75;
+
+        explicit StateTable(size_t expectedStates = 0,
+                            double maxLoadFactor = DEFAULT_MAX_LOAD_FACTOR);
+        ~StateTable();
+        StateTable(const StateTable& other);
+        StateTable& operator=(const StateTable& other);
+
+        // Entry for state, or nullptr when absent
+        Value* find(const State<N>& state);
+        const Value* find(const State<N>& state) const;
+
+        // Entry for state, inserting a fresh one if needed (one probe sequence).
+        // The reference is invalidated by the next insertion.
+        Value& findOrInsert(const State<N>& state, bool& inserted);
+
+        // Remove state's entry if present. Later entries of its probe run are
+        // shifted back into the hole, so no tombstones are left; references
+        // to entries are invalidated.
+        bool erase(const State<N>& state);
+
+        // Make room for expectedStates entries without rehashing. Preallocation
+        // (here and in the constructor) is capped at StateTablePreallocation::bytes;
+        // past that the table doubles on demand.
+        void reserve(size_t expectedStates);
+        void clear();
+
+        size_t size() const;
+        size_t capacity() const;
+        double getMaxLoadFactor() const;
+        size_t memoryUsage() const;
+
+        static size_t bytesPerEntry(double maxLoadFactor = DEFAULT_MAX_LOAD_FACTOR);
+
+    private:
+        struct Slot {
+            State<N> state;
+            Value value;
+        };
+
+        static constexpr size_t MIN_CAPACITY = 1024;
+
+        Slot* _slots;
+        size_t _capacity;       // Always a power of two
+        size_t _mask;
+        size_t _size;
+        size_t _growThreshold;
+        double _maxLoadFactor;
+
+        void allocate(size_t capacity);
+        void rehash(size_t newCapacity);
+        size_t capacityFor(size_t states) const;  // Power of two, capped for preallocation
+};
+
+// Moves from initial to goal, rebuilt backward from goal by undoing the move
+// recorded in each entry. Every state on the way must be in the table.
+template <int N>
+std::vector<uint8_t> tracePath(const StateTable<N, SearchEntry>& table,
+                               const State<N>& initial, const State<N>& goal);
+
+#include "StateTable.tpp"
+
+#endif
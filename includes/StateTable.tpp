@@ -0,0 +1,224 @@
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <algorithm>
+
+template <int N, typename Value>
+StateTable<N, Value>::StateTable(size_t expectedStates, double maxLoadFactor)
+    : _slots(nullptr), _capacity(0), _mask(0), _size(0), _growThreshold(0),
+      _maxLoadFactor(std::min(0.95, std::max(0.25, maxLoadFactor))) {
+    allocate(capacityFor(expectedStates));
+}
+
+template <int N, typename Value>
+StateTable<N, Value>::~StateTable() {
+    std::free(_slots);
+}
+
+template <int N, typename Value>
+StateTable<N, Value>::StateTable(const StateTable& other)
+    : _slots(nullptr), _capacity(0), _mask(0), _size(0), _growThreshold(0),
+      _maxLoadFactor(other._maxLoadFactor) {
+    allocate(other._capacity);
+    std::memcpy(static_cast<void*>(_slots), other._slots, _capacity * sizeof(Slot));
+    _size = other._size;
+}
+
+template <int N, typename Value>
+StateTable<N, Value>& StateTable<N, Value>::operator=(const StateTable& other) {
+    if (this != &other) {
+        std::free(_slots);
+        _slots = nullptr;
+        _maxLoadFactor = other._maxLoadFactor;
+        allocate(other._capacity);
+        std::memcpy(static_cast<void*>(_slots), other._slots, _capacity * sizeof(Slot));
+        _size = other._size;
+    }
+    return *this;
+}
+
+template <int N, typename Value>
+void StateTable<N, Value>::allocate(size_t capacity) {
+    // calloc hands back lazily zeroed pages: an all-zero slot is an empty slot,
+    // so a large preallocation is not zeroed up front; its pages fault in as
+    // the probes first touch them
+    _slots = static_cast<Slot*>(std::calloc(capacity, sizeof(Slot)));
+    if (!_slots) {
+        throw std::bad_alloc();
+    }
+    _capacity = capacity;
+    _mask = capacity - 1;
+    _size = 0;
+    _growThreshold = static_cast<size_t>(capacity * _maxLoadFactor);
+}
+
+template <int N, typename Value>
+size_t StateTable<N, Value>::capacityFor(size_t states) const {
+    size_t wanted = static_cast<size_t>(states / _maxLoadFactor) + 1;
+    size_t limit = std::max(MIN_CAPACITY, StateTablePreallocation::bytes / sizeof(Slot));
+    size_t capacity = MIN_CAPACITY;
+    while (capacity < wanted && capacity * 2 <= limit) {
+        capacity <<= 1;
+    }
+    return capacity;
+}
+
+template <int N, typename Value>
+void StateTable<N, Value>::rehash(size_t newCapacity) {
+    Slot* oldSlots = _slots;
+    size_t oldCapacity = _capacity;
+    size_t oldSize = _size;
+
+    allocate(newCapacity);
+    const State<N> empty;
+    for (size_t i = 0; i < oldCapacity; i++) {
+        if (oldSlots[i].state == empty) {
+            continue;
+        }
+        size_t index = oldSlots[i].state.hash() & _mask;
+        while (!(_slots[index].state == empty)) {
+            index = (index + 1) & _mask;
+        }
+        _slots[index] = oldSlots[i];
+    }
+    _size = oldSize;
+    std::free(oldSlots);
+}
+
+template <int N, typename Value>
+Value* StateTable<N, Value>::find(const State<N>& state) {
+    const State<N> empty;
+    size_t index = state.hash() & _mask;
+    while (true) {
+        Slot& slot = _slots[index];
+        if (slot.state == state) {
+            return &slot.value;
+        }
+        if (slot.state == empty) {
+            return nullptr;
+        }
+        index = (index + 1) & _mask;
+    }
+}
+
+template <int N, typename Value>
+const Value* StateTable<N, Value>::find(const State<N>& state) const {
+    return const_cast<StateTable*>(this)->find(state);
+}
+
+template <int N, typename Value>
+Value& StateTable<N, Value>::findOrInsert(const State<N>& state, bool& inserted) {
+    if (_size >= _growThreshold) {
+        rehash(_capacity * 2);
+    }
+
+    const State<N> empty;
+    size_t index = state.hash() & _mask;
+    while (true) {
+        Slot& slot = _slots[index];
+        if (slot.state == state) {
+            inserted = false;
+            return slot.value;
+        }
+        if (slot.state == empty) {
+            slot.state = state;
+            slot.value = Value();
+            _size++;
+            inserted = true;
+            return slot.value;
+        }
+        index = (index + 1) & _mask;
+    }
+}
+
+template <int N, typename Value>
+bool StateTable<N, Value>::erase(const State<N>& state) {
+    const State<N> empty;
+    size_t hole = state.hash() & _mask;
+    while (!(_slots[hole].state == state)) {
+        if (_slots[hole].state == empty) {
+            return false;
+        }
+        hole = (hole + 1) & _mask;
+    }
+
+    // An entry may fill the hole if the hole lies between its home slot and
+    // where it sits now, otherwise a lookup would stop at the hole first
+    size_t index = (hole + 1) & _mask;
+    while (!(_slots[index].state == empty)) {
+        size_t home = _slots[index].state.hash() & _mask;
+        if (((index - home) & _mask) >= ((index - hole) & _mask)) {
+            _slots[hole] = _slots[index];
+            hole = index;
+        }
+        index = (index + 1) & _mask;
+    }
+    std::memset(static_cast<void*>(&_slots[hole]), 0, sizeof(Slot));
+    _size--;
+    return true;
+}
+
+template <int N, typename Value>
+void StateTable<N, Value>::reserve(size_t expectedStates) {
+    size_t capacity = capacityFor(expectedStates);
+    if (capacity > _capacity) {
+        rehash(capacity);
+    }
+}
+
+template <int N, typename Value>
+void StateTable<N, Value>::clear() {
+    std::memset(static_cast<void*>(_slots), 0, _capacity * sizeof(Slot));
+    _size = 0;
+}
+
+template <int N, typename Value>
+size_t StateTable<N, Value>::size() const {
+    return _size;
+}
+
+template <int N, typename Value>
+size_t StateTable<N, Value>::capacity() const {
+    return _capacity;
+}
+
+template <int N, typename Value>
+double StateTable<N, Value>::getMaxLoadFactor() const {
+    return _maxLoadFactor;
+}
+
+template <int N, typename Value>
+size_t StateTable<N, Value>::memoryUsage() const {
+    return _capacity * sizeof(Slot);
+}
+
+template <int N, typename Value>
+size_t StateTable<N, Value>::bytesPerEntry(double maxLoadFactor) {
+    return static_cast<size_t>(sizeof(Slot) / maxLoadFactor) + 1;
+}
+
+template <int N>
+std::vector<uint8_t> tracePath(const StateTable<N, SearchEntry>& table,
+                               const State<N>& initial, const State<N>& goal) {
+    std::vector<uint8_t> path;
+
+    State<N> state = goal;
+    int zeroPos = 0;
+    while (state.get(zeroPos) != 0) {
+        zeroPos++;
+    }
+
+    while (state != initial) {
+        const SearchEntry* entry = table.find(state);
+        uint8_t move = entry->move;
+        path.push_back(move);
+
+        // The blank came from the opposite neighbor: slide that tile back
+        int previousZeroPos = Board<N>::NEIGHBORS[zeroPos][move ^ 1];
+        state.slide(zeroPos, previousZeroPos);
+        zeroPos = previousZeroPos;
+    }
+
+    std::reverse(path.begin(), path.end());
+    return path;
+}
@@ -3,11 +3,11 @@
 
 #include "Puzzle.hpp"
 #include "Node.hpp"
+#include "BucketQueue.hpp"
 #include <map>
 #include <string>
 #include <vector>
 #include <cstdint>
-#include <memory>
 #include <unordered_map>
 
 struct UCSResult {
@@ -22,14 +22,7 @@ struct UCSResult {
     std::string algorithmName;
     bool memoryLimitReached;
     std::string failureReason;
-};
-
-// Comparator for priority queue of shared_ptr<Node> - UCS only uses g(n)
-struct UCSNodePtrComparator {
-    bool operator()(const std::shared_ptr<Node>& a, const std::shared_ptr<Node>& b) const {
-        // For min-heap, return true if a has HIGHER cost (worse g-value)
-        return a->getCost() > b->getCost();
-    }
+    int tieBreaking;  // TieBreaking of the open list
 };
 
 class UCS {
@@ -40,23 +33,28 @@ class UCS {
         UCS& operator=(const UCS& other);
 
         // UCS (Uniform Cost Search / Dijkstra's) with memory limit and timeout
-        UCSResult solve(Puzzle& puzzle, int size, bool silent = false, 
-                       size_t maxStates = 0, double maxTimeSeconds = 0);
+        template <int N>
+        UCSResult solve(Puzzle& puzzle, bool silent = false, 
+                       size_t maxStates = 0, double maxTimeSeconds = 0,
+                       TieBreaking tieBreaking = TIE_HIGH_G);
         
         // Memory management
+        template <int N>
         static size_t estimateMemoryUsage(size_t numStates);
 
     private:
         // Helper functions
+        template <int N>
         struct Neighbor {
-            std::vector<uint8_t> state;
+            State<N> state;
             uint8_t zeroPos;
-            std::string action;
+            uint8_t move;       // MoveDirection of the blank
         };
         
-        void getNeighbors(const Node& node, std::vector<Neighbor>& neighbors);
-        bool isGoal(const std::vector<uint8_t>& state, 
-                   const std::vector<uint8_t>& goal);
+        template <int N>
+        void getNeighbors(const Node<N>& node, std::vector<Neighbor<N>>& neighbors);
+        template <int N>
+        bool isGoal(const State<N>& state, const State<N>& goal);
 };
 
 #endif
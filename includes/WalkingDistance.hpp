@@ -0,0 +1,57 @@
+#ifndef WALKINGDISTANCE_HPP
+#define WALKINGDISTANCE_HPP
+
+#include <vector>
+#include <unordered_map>
+#include <cstdint>
+#include <cstddef>
+
+// Walking distance table for one orientation (rows or columns) of a board.
+// A pattern forgets which tile is which and keeps, for every line, how many
+// of its tiles belong to each goal line, plus the line the blank is on.
+// Vertical moves only ever swap the blank with a tile of the line above or
+// below, so the number of moves to sort the rows of a pattern is a lower
+// bound on the vertical moves of any solution; the same table read with
+// columns bounds the horizontal ones, and the two add up.
+// The whole abstract space is searched once (24964 patterns on 4x4) and every
+// pattern's successors are kept, so a move updates a pattern in one lookup.
+class WalkingDistance {
+    public:
+        static constexpr int MAX_SIZE = 4;          // 5x5 has ~65M patterns
+        static constexpr uint32_t NO_PATTERN = 0xFFFFFFFF;
+
+        WalkingDistance();
+        // Table for size x size boards whose goal has the blank on goalBlankLine
+        WalkingDistance(int size, int goalBlankLine);
+        ~WalkingDistance();
+        WalkingDistance(const WalkingDistance& other);
+        WalkingDistance& operator=(const WalkingDistance& other);
+
+        static bool isSupported(int size);
+
+        // Shared table, built on first use
+        static const WalkingDistance& get(int size, int goalBlankLine);
+
+        // Pattern with counts[line * size + goalLine] tiles and the blank on blankLine
+        uint32_t find(const uint8_t* counts, int blankLine) const;
+
+        // Pattern after the blank moves to the next (forward) or previous line,
+        // swapping with a tile whose goal line is goalLine
+        uint32_t next(uint32_t pattern, bool forward, int goalLine) const;
+
+        int distance(uint32_t pattern) const;
+        size_t getPatternCount() const;
+
+    private:
+        static constexpr int BITS_PER_COUNT = 3;
+
+        int _size;
+        std::vector<uint8_t> _distance;                     // Moves to the goal, by pattern
+        std::vector<uint32_t> _next;                        // [pattern][forward][goal line]
+        std::unordered_map<uint64_t, uint32_t> _patterns;   // Packed counts -> pattern
+
+        static uint64_t pack(const uint8_t* counts, int blankLine, int size);
+        void build(int goalBlankLine);
+};
+
+#endif
@@ -9,31 +9,52 @@
 #include <string>
 #include <vector>
 #include <cstdint>
-#include <memory>
 #include <unordered_map>
 
 class WeightedAstar {
     public:
+        static constexpr double DEFAULT_ANYTIME_WEIGHT = 3.0;
+        static constexpr double DEFAULT_WEIGHT_STEP = 0.5;
+
         WeightedAstar();
         ~WeightedAstar();
         WeightedAstar(const WeightedAstar& other);
         WeightedAstar& operator=(const WeightedAstar& other);
 
         // Weighted A* with configurable weight parameter
-        AStarResult solve(Puzzle& puzzle, int size, int heuristic, bool silent = false, 
-                         size_t maxStates = 0, double maxTimeSeconds = 0, double weight = 1.5);
+        template <int N>
+        AStarResult solve(Puzzle& puzzle, int heuristic, bool silent = false, 
+                         size_t maxStates = 0, double maxTimeSeconds = 0, double weight = 1.5,
+                         TieBreaking tieBreaking = TIE_HIGH_G);
+
+        // Anytime Repairing A* (ARA*): Weighted A* passes with the weight
+        // lowered by weightStep after each one, down to 1. A pass resumes from
+        // the open list and table of the previous one; states improved after
+        // their expansion wait in an INCONS list and rejoin the open list when
+        // the weight changes. Each new solution is printed with its
+        // suboptimality bound, and the best one so far is returned when the
+        // time or memory limit cuts the search short.
+        template <int N>
+        AStarResult solveAnytime(Puzzle& puzzle, int heuristic, bool silent = false,
+                                 size_t maxStates = 0, double maxTimeSeconds = 0,
+                                 double initialWeight = DEFAULT_ANYTIME_WEIGHT,
+                                 double weightStep = DEFAULT_WEIGHT_STEP,
+                                 TieBreaking tieBreaking = TIE_HIGH_G);
 
     private:
         // Helper functions
+        template <int N>
         struct Neighbor {
-            std::vector<uint8_t> state;
+            State<N> state;
             uint8_t zeroPos;
-            std::string action;
+            uint8_t move;       // MoveDirection of the blank
         };
         
-        void getNeighbors(const Node& node, std::vector<Neighbor>& neighbors);
-        bool isGoal(const std::vector<uint8_t>& state, 
-                   const std::vector<uint8_t>& goal);
+        template <int N>
+        void getNeighbors(const Node<N>& node, std::vector<Neighbor<N>>& neighbors);
+        template <int N>
+        bool isGoal(const State<N>& state, const State<N>& goal);
+        template <int N>
         size_t estimateMemoryUsage(size_t numStates);
 };
 
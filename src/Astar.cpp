@@ -1,10 +1,10 @@
 #include "../includes/Astar.hpp"
 #include "../includes/Heuristic.hpp"
 #include "../includes/SolutionLogger.hpp"
+#include "../includes/StateTable.hpp"
+#include "../includes/NodeArena.hpp"
+#include "../includes/BucketQueue.hpp"
 #include <iostream>
-#include <queue>
-#include <unordered_set>
-#include <unordered_map>
 #include <chrono>
 #include <iomanip>
 #include <algorithm>
@@ -25,85 +25,71 @@ Astar& Astar::operator=(const Astar& other) {
 }
 
 // Estimate memory usage in bytes
+template <int N>
 size_t Astar::estimateMemoryUsage(size_t numStates) {
-    const size_t BYTES_PER_NODE = 60;   // Optimized: removed parent & action (was 130)
-    const size_t HASH_OVERHEAD = 16;    // Per entry in unordered_set/map
-    return numStates * (BYTES_PER_NODE + HASH_OVERHEAD * 2);  // Node + closedSet + gScores
+    // Arena node plus its open-list pointer; no parent chain is kept alive
+    const size_t BYTES_PER_NODE = sizeof(Node<N>) + sizeof(Node<N>*);
+    // Closed set and g-scores share one inline slot per state
+    return numStates * (BYTES_PER_NODE + StateTable<N, SearchEntry>::bytesPerEntry());
 }
 
-void Astar::getNeighbors(const Node& node, std::vector<Neighbor>& neighbors) {
+template <int N>
+void Astar::getNeighbors(const Node<N>& node, std::vector<Neighbor<N>>& neighbors) {
     neighbors.clear();
     
-    const std::vector<uint8_t>& state = node.getState();
-    int size = node.getSize();
+    const State<N>& state = node.getState();
     uint8_t zeroPos = node.getZeroPos();
     
-    int row = zeroPos / size;
-    int col = zeroPos % size;
-    
-    // Define possible moves: up, down, left, right
-    struct Move {
-        int dr, dc;
-        const char* action;
-    };
-    
-    static const Move moves[] = {
-        {-1, 0, "up"},
-        {1, 0, "down"},
-        {0, -1, "left"},
-        {0, 1, "right"}
-    };
-    
-    neighbors.reserve(4);
-    
-    for (const auto& move : moves) {
-        int newRow = row + move.dr;
-        int newCol = col + move.dc;
+    for (int move = 0; move < MOVE_COUNT; move++) {
+        int newZeroPos = Board<N>::NEIGHBORS[zeroPos][move];
         
         // Check if move is valid
-        if (newRow >= 0 && newRow < size && newCol >= 0 && newCol < size) {
-            uint8_t newZeroPos = newRow * size + newCol;
-            
-            // Create new state by swapping blank with target tile
-            std::vector<uint8_t> newState = state;
-            std::swap(newState[zeroPos], newState[newZeroPos]);
+        if (newZeroPos != Board<N>::NO_CELL) {
+            // Create new state by sliding the target tile into the blank
+            State<N> newState = state;
+            newState.slide(zeroPos, newZeroPos);
             
-            // Use emplace_back with move semantics to avoid extra copy
-            neighbors.emplace_back(Neighbor{std::move(newState), newZeroPos, move.action});
+            neighbors.emplace_back(Neighbor<N>{newState, static_cast<uint8_t>(newZeroPos), static_cast<uint8_t>(move)});
         }
     }
 }
 
 
-bool Astar::isGoal(const std::vector<uint8_t>& state,
-                   const std::vector<uint8_t>& goal) {
+template <int N>
+bool Astar::isGoal(const State<N>& state, const State<N>& goal) {
     return state == goal;
 }
 
-AStarResult Astar::solve(Puzzle& puzzle, int size, int heuristic, bool silent, size_t maxStates, double maxTimeSeconds) {
+template <int N>
+AStarResult Astar::solve(Puzzle& puzzle, int heuristic, bool silent, size_t maxStates, double maxTimeSeconds,
+                         TieBreaking tieBreaking) {
     auto startTime = std::chrono::high_resolution_clock::now();
     
     // Get initial state and goal
     const std::vector<uint8_t>& initialState = puzzle.getGrid();
     const std::vector<uint8_t>& goal = puzzle.getGoal();
     
+    // Packed search representation of the start and goal boards
+    const State<N> initial(initialState);
+    const State<N> goalState(goal);
+    
     // Display memory and time limits (set by Game class)
     if (!silent) {
-        size_t estimatedMB = estimateMemoryUsage(maxStates) / (1024 * 1024);
+        size_t estimatedMB = estimateMemoryUsage<N>(maxStates) / (1024 * 1024);
         std::cout << "\n[Memory Safety] Max states limited to " << maxStates 
                  << " (~" << estimatedMB << " MB)\n";
         std::cout << "[Time Safety] Max execution time: " << maxTimeSeconds << " seconds\n";
     }
     
     // Check if already at goal
-    if (isGoal(initialState, goal)) {
+    if (isGoal(initial, goalState)) {
         if (!silent) {
             std::cout << "\nPuzzle is already solved!\n";
         }
         auto endTime = std::chrono::high_resolution_clock::now();
         double duration = std::chrono::duration<double>(endTime - startTime).count();
         
-        return {true, 0, 0, 0, duration, heuristic, "", 1, "A*", false, "", 1.0};
+        return {true, 0, 0, 0, duration, heuristic, "", 1, "A*", false, "", 1.0, {}, tieBreaking};
     }
     
     // Check if puzzle is solvable
@@ -112,24 +98,21 @@ AStarResult Astar::solve(Puzzle& puzzle, int size, int heuristic, bool silent, s
             std::cout << "\nPuzzle is unsolvable!\n";
             
             // Log failure to file
-            std::string heuristicName;
-            if (heuristic == 1) heuristicName = "Manhattan Distance";
-            else if (heuristic == 2) heuristicName = "Hamming Distance";
-            else if (heuristic == 3) heuristicName = "Linear Conflict";
+            std::string heuristicName = getHeuristicName(heuristic);
             
             SolutionLogger::logFailure(
-                "A*", heuristicName, initialState, goal, size,
+                "A*", heuristicName, initialState, goal, N,
                 "Puzzle is unsolvable", 0, 0, 0
             );
         }
         auto endTime = std::chrono::high_resolution_clock::now();
         double duration = std::chrono::duration<double>(endTime - startTime).count();
         
-        return {false, 0, 0, 0, duration, heuristic, "", 1, "A*", false, "Puzzle is unsolvable", 1.0};
+        return {false, 0, 0, 0, duration, heuristic, "", 1, "A*", false, "Puzzle is unsolvable", 1.0, {}, tieBreaking};
     }
     
-    // Pre-compute goal lookup table once (avoids repeated allocations in heuristics)
-    GoalLookup goalLookup(goal, size);
+    // Goal lookup and per-move delta tables, built once per goal and heuristic
+    const Heuristic<N>& estimator = Heuristic<N>::get(goal, heuristic);
     
     // Initialize statistics
     int totalSetOpened = 0;
@@ -145,26 +128,27 @@ AStarResult Astar::solve(Puzzle& puzzle, int size, int heuristic, bool silent, s
     }
     
     // Calculate initial heuristic
-    int initialH = Heuristic::getHeuristicValue(initialState, goalLookup, size, heuristic);
+    HeuristicCache<N> initialCache;
+    int initialH = estimator.evaluate(initial, initialCache);
     
-    // Create initial node (with optional parent tracking for logging)
-    auto startNode = std::make_shared<Node>(initialState, size, initialZeroPos, 0, initialH, nullptr, "");
+    // All nodes of this search live in one arena, released in one shot on return
+    NodeArena<Node<N>> nodes;
     
-    // Priority queue for open set - now stores shared_ptr to avoid copies
-    std::priority_queue<std::shared_ptr<Node>, 
-                       std::vector<std::shared_ptr<Node>>, 
-                       NodePtrComparator> openSet;
-    openSet.push(startNode);
+    // Create initial node
+    Node<N>* startNode = nodes.create(initial, initialZeroPos, 0, initialH, initialCache);
     
-    // Set to track visited states (closed set)
-    std::unordered_set<size_t> closedSet;
+    // Open set bucketed by f then g - holds arena pointers, no copies
+    BucketQueue<Node<N>*> openSet(tieBreaking);
+    openSet.push(startNode);
     
-    // Dictionary to track best cost to reach each state
-    std::unordered_map<size_t, int> gScores;
-    gScores[startNode->hash()] = 0;
+    // Closed set and best path costs in one open-addressing table keyed by
+    // the full board (no hash-collision pruning, one probe per child)
+    StateTable<N, SearchEntry> table(maxStates);
+    bool startInserted;
+    table.findOrInsert(initial, startInserted) = SearchEntry{0, false, MOVE_UP};
     
     // Reusable neighbor vector to avoid repeated allocations
-    std::vector<Neighbor> neighbors;
+    std::vector<Neighbor<N>> neighbors;
     neighbors.reserve(4);
     
     while (!openSet.empty()) {
@@ -188,24 +172,22 @@ AStarResult Astar::solve(Puzzle& puzzle, int size, int heuristic, bool silent, s
                              << elapsed << "s\n";
                     
                     // Log failure to file
-                    std::string heuristicName;
-                    if (heuristic == 1) heuristicName = "Manhattan Distance";
-                    else if (heuristic == 2) heuristicName = "Hamming Distance";
-                    else if (heuristic == 3) heuristicName = "Linear Conflict";
+                    std::string heuristicName = getHeuristicName(heuristic);
                     
                     SolutionLogger::logFailure(
-                        "A*", heuristicName, initialState, goal, size,
+                        "A*", heuristicName, initialState, goal, N,
                         "Timeout reached", totalSetOpened, maxStatesEnqueued, elapsed
                     );
                 }
                 
                 return {false, 0, totalSetOpened, maxStatesEnqueued, elapsed, heuristic, "", 
-                        1, "A*", false, "Timeout reached", 1.0};
+                        1, "A*", false, "Timeout reached", 1.0, {}, tieBreaking};
             }
         }
         
-        // Memory limit check - prevent crash
-        if (totalSetOpened >= static_cast<int>(maxStates)) {
+        // Memory limit check - every node created stays in the arena until
+        // the search returns, so count those rather than expansions
+        if (nodes.size() >= maxStates) {
             auto endTime = std::chrono::high_resolution_clock::now();
             double duration = std::chrono::duration<double>(endTime - startTime).count();
             
@@ -216,32 +198,29 @@ AStarResult Astar::solve(Puzzle& puzzle, int size, int heuristic, bool silent, s
                 std::cout << "Explored " << totalSetOpened << " states before hitting limit\n";
                 std::cout << "Maximum states in memory: " << maxStatesEnqueued << "\n";
                 std::cout << "Estimated memory used: " 
-                         << (estimateMemoryUsage(totalSetOpened) / (1024 * 1024)) << " MB\n";
+                         << (estimateMemoryUsage<N>(totalSetOpened) / (1024 * 1024)) << " MB\n";
                 std::cout << "Execution time: " << std::fixed << std::setprecision(4) 
                          << duration << "s\n";
                 
                 // Log failure to file
-                std::string heuristicName;
-                if (heuristic == 1) heuristicName = "Manhattan Distance";
-                else if (heuristic == 2) heuristicName = "Hamming Distance";
-                else if (heuristic == 3) heuristicName = "Linear Conflict";
+                std::string heuristicName = getHeuristicName(heuristic);
                 
                 SolutionLogger::logFailure(
-                    "A*", heuristicName, initialState, goal, size,
+                    "A*", heuristicName, initialState, goal, N,
                     "Memory limit reached", totalSetOpened, maxStatesEnqueued, duration
                 );
             }
             
             return {false, 0, totalSetOpened, maxStatesEnqueued, duration, heuristic, "", 
-                    1, "A*", true, "Memory limit reached", 1.0};
+                    1, "A*", true, "Memory limit reached", 1.0, {}, tieBreaking};
         }
         
         // Get node with lowest f value (no copy, just pointer)
-        auto current = openSet.top();
+        Node<N>* current = openSet.top();
         openSet.pop();
         
         // Check if we reached the goal
-        if (isGoal(current->getState(), goal)) {
+        if (isGoal(current->getState(), goalState)) {
             int moves = current->getCost();
             
             auto endTime = std::chrono::high_resolution_clock::now();
@@ -254,31 +233,29 @@ AStarResult Astar::solve(Puzzle& puzzle, int size, int heuristic, bool silent, s
                 std::cout << "Total moves required: " << moves << "\n";
                 std::cout << "Total states opened (time complexity): " << totalSetOpened << "\n";
                 std::cout << "Maximum states in memory (space complexity): " << maxStatesEnqueued << "\n";
+                std::cout << "Tie-breaking: " << getTieBreakingName(tieBreaking) << "\n";
                 std::cout << "Execution time: " << std::fixed << std::setprecision(4) 
                          << duration << "s\n";
                 std::cout << std::string(50, '=') << "\n";
                 
                 // Log solution to file
-                std::string heuristicName;
-                if (heuristic == 1) heuristicName = "Manhattan Distance";
-                else if (heuristic == 2) heuristicName = "Hamming Distance";
-                else if (heuristic == 3) heuristicName = "Linear Conflict";
+                std::string heuristicName = getHeuristicName(heuristic);
                 
                 SolutionLogger::logSolution(
-                    "A*", heuristicName, initialState, goal, size,
-                    current, moves, totalSetOpened, maxStatesEnqueued, duration
+                    "A*", heuristicName, initialState, goal, N,
+                    tracePath(table, initial, current->getState()), moves, totalSetOpened, maxStatesEnqueued, duration
                 );
             }
             
-            return {true, moves, totalSetOpened, maxStatesEnqueued, duration, heuristic, "", 1, "A*", false, "", 1.0};
+            return {true, moves, totalSetOpened, maxStatesEnqueued, duration, heuristic, "", 1, "A*", false, "", 1.0, {}, tieBreaking};
         }
         
-        // Add current state to closed set
-        size_t currentHash = current->hash();
-        if (closedSet.find(currentHash) != closedSet.end()) {
+        // Add current state to closed set (its entry was created when it was pushed)
+        SearchEntry* currentEntry = table.find(current->getState());
+        if (currentEntry->closed || current->getCost() > currentEntry->g) {
             continue;
         }
-        closedSet.insert(currentHash);
+        currentEntry->closed = true;
         totalSetOpened++;
         
         // Generate and process neighbors (reuses vector to avoid allocations)
@@ -287,36 +264,37 @@ AStarResult Astar::solve(Puzzle& puzzle, int size, int heuristic, bool silent, s
         for (auto& neighbor : neighbors) {
             // Calculate costs
             int gCost = current->getCost() + 1;
-            int hCost = Heuristic::getHeuristicValue(neighbor.state, goalLookup, size, heuristic);
-            
-            // Create neighbor node with parent tracking for path reconstruction
-            auto neighborNode = std::make_shared<Node>(
-                std::move(neighbor.state),
-                size,
-                neighbor.zeroPos,
-                gCost,
-                hCost,
-                current,  // Track parent for path reconstruction
-                neighbor.action  // Track action that led to this state
-            );
-            
-            size_t neighborHash = neighborNode->hash();
-            
-            // Skip if already visited
-            if (closedSet.find(neighborHash) != closedSet.end()) {
-                continue;
-            }
             
-            // Check if this is a better path to this state
-            if (gScores.find(neighborHash) != gScores.end() && 
-                gScores[neighborHash] <= gCost) {
+            // One probe: skip paths that are not better. With a consistent
+            // heuristic that covers every closed state; an inconsistent one
+            // (Linear Conflict's pair count, min-blank pattern databases) can
+            // find a shorter path to a closed state, which is then reopened.
+            bool inserted;
+            SearchEntry& entry = table.findOrInsert(neighbor.state, inserted);
+            if (!inserted && entry.g <= gCost) {
                 continue;
             }
             
             // Record the path cost
-            gScores[neighborHash] = gCost;
+            entry.g = gCost;
+            entry.closed = false;
+            entry.move = neighbor.move;
+            
+            // Only the slid tile changed: update the parent's cached heuristic parts
+            HeuristicCache<N> cache;
+            int hCost = estimator.evaluateMove(neighbor.state, current->getZeroPos(), neighbor.move,
+                                               current->getHeuristicCache(), cache);
+            
+            // Create neighbor node
+            Node<N>* neighborNode = nodes.create(
+                neighbor.state,
+                neighbor.zeroPos,
+                gCost,
+                hCost,
+                cache
+            );
             
-            // Add to open set (stores shared_ptr, no copy)
+            // Add to open set (stores the arena pointer, no copy)
             openSet.push(neighborNode);
         }
     }
@@ -336,18 +314,18 @@ AStarResult Astar::solve(Puzzle& puzzle, int size, int heuristic, bool silent, s
         std::cout << std::string(50, '=') << "\n";
         
         // Log failure to file
-        std::string heuristicName;
-        if (heuristic == 1) heuristicName = "Manhattan Distance";
-        else if (heuristic == 2) heuristicName = "Hamming Distance";
-        else if (heuristic == 3) heuristicName = "Linear Conflict";
+        std::string heuristicName = getHeuristicName(heuristic);
         
         SolutionLogger::logFailure(
-            "A*", heuristicName, initialState, goal, size,
+            "A*", heuristicName, initialState, goal, N,
             "No solution found", totalSetOpened, maxStatesEnqueued, duration
         );
     }
     
     return {false, 0, totalSetOpened, maxStatesEnqueued, duration, heuristic, "", 
-            1, "A*", false, "No solution found", 1.0};
+            1, "A*", false, "No solution found", 1.0, {}, tieBreaking};
 }
 
+#define INSTANTIATE_ASTAR(N) \
+    template AStarResult Astar::solve<N>(Puzzle&, int, bool, size_t, double, TieBreaking);
+NPUZZLE_FOR_EACH_SIZE(INSTANTIATE_ASTAR)
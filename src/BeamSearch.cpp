@@ -1,10 +1,9 @@
 #include "../includes/BeamSearch.hpp"
 #include "../includes/Heuristic.hpp"
 #include "../includes/SolutionLogger.hpp"
+#include "../includes/StateTable.hpp"
 #include <iostream>
-#include <queue>
-#include <unordered_set>
-#include <unordered_map>
+#include <thread>
 #include <chrono>
 #include <iomanip>
 #include <algorithm>
@@ -25,87 +24,90 @@ BeamSearch& BeamSearch::operator=(const BeamSearch& other) {
 }
 
 // Estimate memory usage in bytes
+template <int N>
 size_t BeamSearch::estimateMemoryUsage(size_t numStates) {
-    const size_t BYTES_PER_NODE = 60;   // Optimized: removed parent & action
-    const size_t HASH_OVERHEAD = 16;    // Per entry in unordered_set
-    return numStates * (BYTES_PER_NODE + HASH_OVERHEAD);
+    // Node held by value in the beam or a candidate buffer; no parent chain is kept alive
+    const size_t BYTES_PER_NODE = sizeof(Node<N>);
+    // Closed set: one inline slot per state at the table's load factor
+    return numStates * (BYTES_PER_NODE + StateTable<N, SearchEntry>::bytesPerEntry());
 }
 
-void BeamSearch::getNeighbors(const Node& node, std::vector<Neighbor>& neighbors) {
-    neighbors.clear();
-    
-    const std::vector<uint8_t>& state = node.getState();
-    int size = node.getSize();
-    uint8_t zeroPos = node.getZeroPos();
-    
-    int row = zeroPos / size;
-    int col = zeroPos % size;
-    
-    // Define possible moves: up, down, left, right
-    struct Move {
-        int dr, dc;
-        const char* action;
-    };
-    
-    static const Move moves[] = {
-        {-1, 0, "up"},
-        {1, 0, "down"},
-        {0, -1, "left"},
-        {0, 1, "right"}
-    };
-    
-    neighbors.reserve(4);
-    
-    for (const auto& move : moves) {
-        int newRow = row + move.dr;
-        int newCol = col + move.dc;
+template <int N>
+void BeamSearch::expand(const std::vector<Node<N>>& beam, size_t first, size_t last,
+                        const StateTable<N, SearchEntry>& closedSet,
+                        const Heuristic<N>& estimator, Expansion<N>& expansion) {
+    for (size_t i = first; i < last; i++) {
+        const Node<N>& current = beam[i];
+        uint8_t zeroPos = current.getZeroPos();
         
-        // Check if move is valid
-        if (newRow >= 0 && newRow < size && newCol >= 0 && newCol < size) {
-            uint8_t newZeroPos = newRow * size + newCol;
+        for (int move = 0; move < MOVE_COUNT; move++) {
+            int newZeroPos = Board<N>::NEIGHBORS[zeroPos][move];
+            if (newZeroPos == Board<N>::NO_CELL) {
+                continue;
+            }
             
-            // Create new state by swapping blank with target tile
-            std::vector<uint8_t> newState = state;
-            std::swap(newState[zeroPos], newState[newZeroPos]);
+            // Slide the target tile into the blank
+            State<N> child = current.getState();
+            child.slide(zeroPos, newZeroPos);
             
-            // Use emplace_back with move semantics to avoid extra copy
-            neighbors.emplace_back(Neighbor{std::move(newState), newZeroPos, move.action});
+            // Skip if already visited (before paying for h); the table is
+            // only read while the workers run
+            if (closedSet.find(child) != nullptr) {
+                continue;
+            }
+            
+            // Only the slid tile changed: update the parent's cached heuristic parts
+            HeuristicCache<N> cache;
+            int hCost = estimator.evaluateMove(child, zeroPos, move, current.getHeuristicCache(), cache);
+            
+            expansion.candidates.emplace_back(child, static_cast<uint8_t>(newZeroPos), current.getCost() + 1,
+                                              hCost, cache, static_cast<uint8_t>(move));
+            if (hCost >= static_cast<int>(expansion.countByH.size())) {
+                expansion.countByH.resize(hCost + 1, 0);
+            }
+            expansion.countByH[hCost]++;
         }
     }
 }
 
-
-bool BeamSearch::isGoal(const std::vector<uint8_t>& state,
-                        const std::vector<uint8_t>& goal) {
+template <int N>
+bool BeamSearch::isGoal(const State<N>& state, const State<N>& goal) {
     return state == goal;
 }
 
-BeamSearchResult BeamSearch::solve(Puzzle& puzzle, int size, int heuristic, bool silent, 
-                                   size_t maxStates, double maxTimeSeconds, int beamWidth) {
+template <int N>
+BeamSearchResult BeamSearch::solve(Puzzle& puzzle, int heuristic, bool silent, 
+                                   size_t maxStates, double maxTimeSeconds, int beamWidth,
+                                   int threads, TieBreaking tieBreaking) {
     auto startTime = std::chrono::high_resolution_clock::now();
     
     // Get initial state and goal
     const std::vector<uint8_t>& initialState = puzzle.getGrid();
     const std::vector<uint8_t>& goal = puzzle.getGoal();
     
+    // Packed search representation of the start and goal boards
+    const State<N> initial(initialState);
+    const State<N> goalState(goal);
+    
     // Display memory and time limits (set by Game class)
     if (!silent) {
-        size_t estimatedMB = estimateMemoryUsage(maxStates) / (1024 * 1024);
+        size_t estimatedMB = estimateMemoryUsage<N>(maxStates) / (1024 * 1024);
         std::cout << "\n[Memory Safety] Max states limited to " << maxStates 
                  << " (~" << estimatedMB << " MB)\n";
         std::cout << "[Time Safety] Max execution time: " << maxTimeSeconds << " seconds\n";
         std::cout << "[Beam Search] Beam width (k): " << beamWidth << "\n";
+        std::cout << "[Threads] " << threads << " workers expanding each level\n";
     }
     
     // Check if already at goal
-    if (isGoal(initialState, goal)) {
+    if (isGoal(initial, goalState)) {
         if (!silent) {
             std::cout << "\nPuzzle is already solved!\n";
         }
         auto endTime = std::chrono::high_resolution_clock::now();
         double duration = std::chrono::duration<double>(endTime - startTime).count();
         
-        return {true, 0, 0, 0, duration, heuristic, "", 7, "Beam Search", false, "", beamWidth};
+        return {true, 0, 0, 0, duration, heuristic, "", 7, "Beam Search", false, "", beamWidth, tieBreaking};
     }
     
     // Check if puzzle is solvable
@@ -116,11 +118,11 @@ BeamSearchResult BeamSearch::solve(Puzzle& puzzle, int size, int heuristic, bool
         auto endTime = std::chrono::high_resolution_clock::now();
         double duration = std::chrono::duration<double>(endTime - startTime).count();
         
-        return {false, 0, 0, 0, duration, heuristic, "", 7, "Beam Search", false, "Puzzle is unsolvable", beamWidth};
+        return {false, 0, 0, 0, duration, heuristic, "", 7, "Beam Search", false, "Puzzle is unsolvable", beamWidth, tieBreaking};
     }
     
-    // Pre-compute goal lookup table once
-    GoalLookup goalLookup(goal, size);
+    // Goal lookup and per-move delta tables, built once per goal and heuristic
+    const Heuristic<N>& estimator = Heuristic<N>::get(goal, heuristic);
     
     // Initialize statistics
     int totalSetOpened = 0;
@@ -136,21 +138,24 @@ BeamSearchResult BeamSearch::solve(Puzzle& puzzle, int size, int heuristic, bool
     }
     
     // Calculate initial heuristic
-    int initialH = Heuristic::getHeuristicValue(initialState, goalLookup, size, heuristic);
+    HeuristicCache<N> initialCache;
+    int initialH = estimator.evaluate(initial, initialCache);
     
-    // Create initial node (with optional parent tracking for logging)
-    auto startNode = std::make_shared<Node>(initialState, size, initialZeroPos, 0, initialH, nullptr, "");
+    // Beam: current level of nodes to expand. Nodes are held by value in
+    // buffers reused from level to level; the path comes from the closed set
+    std::vector<Node<N>> beam;
+    std::vector<Node<N>> nextBeam;
+    beam.emplace_back(initial, initialZeroPos, 0, initialH, initialCache);
     
-    // Beam: current level of nodes to expand
-    std::vector<std::shared_ptr<Node>> beam;
-    beam.push_back(startNode);
+    // Visited states (closed set), keyed by the full board
+    StateTable<N, SearchEntry> closedSet(maxStates);
     
-    // Set to track visited states (closed set)
-    std::unordered_set<size_t> closedSet;
-    
-    // Reusable neighbor vector to avoid repeated allocations
-    std::vector<Neighbor> neighbors;
-    neighbors.reserve(4);
+    // One candidate buffer per worker
+    threads = std::max(1, threads);
+    std::vector<Expansion<N>> expansions(threads);
+    std::vector<int> total;
+    std::vector<int> kept;
+    std::vector<int> start;
     
     while (!beam.empty()) {
         // Timeout check - prevent infinite execution
@@ -171,7 +176,7 @@ BeamSearchResult BeamSearch::solve(Puzzle& puzzle, int size, int heuristic, bool
                 }
                 
                 return {false, 0, totalSetOpened, maxStatesEnqueued, elapsed, heuristic, "", 
-                        7, "Beam Search", false, "Timeout reached", beamWidth};
+                        7, "Beam Search", false, "Timeout reached", beamWidth, tieBreaking};
             }
         }
         
@@ -187,23 +192,24 @@ BeamSearchResult BeamSearch::solve(Puzzle& puzzle, int size, int heuristic, bool
                 std::cout << "Explored " << totalSetOpened << " states before hitting limit\n";
                 std::cout << "Maximum states in memory: " << maxStatesEnqueued << "\n";
                 std::cout << "Estimated memory used: " 
-                         << (estimateMemoryUsage(totalSetOpened) / (1024 * 1024)) << " MB\n";
+                         << (estimateMemoryUsage<N>(totalSetOpened) / (1024 * 1024)) << " MB\n";
                 std::cout << "Execution time: " << std::fixed << std::setprecision(4) 
                          << duration << "s\n";
             }
             
             return {false, 0, totalSetOpened, maxStatesEnqueued, duration, heuristic, "", 
-                    7, "Beam Search", true, "Memory limit reached", beamWidth};
+                    7, "Beam Search", true, "Memory limit reached", beamWidth, tieBreaking};
         }
         
-        // Next level of candidates
-        std::vector<std::shared_ptr<Node>> candidates;
-        
-        // Expand all nodes in current beam
-        for (const auto& current : beam) {
+        // Goal test and closed set first, in beam order: the nodes left to
+        // expand are packed at the front of the beam
+        size_t expanding = 0;
+        for (size_t i = 0; i < beam.size(); i++) {
+            const Node<N>& current = beam[i];
+            
             // Check if we reached the goal
-            if (isGoal(current->getState(), goal)) {
-                int moves = current->getCost();
+            if (isGoal(current.getState(), goalState)) {
+                int moves = current.getCost();
                 
                 auto endTime = std::chrono::high_resolution_clock::now();
                 double duration = std::chrono::duration<double>(endTime - startTime).count();
@@ -216,66 +222,71 @@ BeamSearchResult BeamSearch::solve(Puzzle& puzzle, int size, int heuristic, bool
                     std::cout << "Total states opened (time complexity): " << totalSetOpened << "\n";
                     std::cout << "Maximum states in memory (space complexity): " << maxStatesEnqueued << "\n";
                     std::cout << "Beam width (k): " << beamWidth << "\n";
+                    std::cout << "Tie-breaking: " << getTieBreakingName(tieBreaking) << "\n";
                     std::cout << "Execution time: " << std::fixed << std::setprecision(4) 
                              << duration << "s\n";
                     std::cout << std::string(50, '=') << "\n";
                     
                     // Log solution to file
-                    std::string heuristicName;
-                    if (heuristic == 1) heuristicName = "Manhattan Distance";
-                    else if (heuristic == 2) heuristicName = "Hamming Distance";
-                    else if (heuristic == 3) heuristicName = "Linear Conflict";
+                    std::string heuristicName = getHeuristicName(heuristic);
+                    
+                    // The goal is never expanded: record how it was reached before tracing
+                    bool goalInserted;
+                    closedSet.findOrInsert(current.getState(), goalInserted).move = current.getMove();
                     
                     SolutionLogger::logSolution(
-                        "Beam Search", heuristicName, initialState, goal, size,
-                        current, moves, totalSetOpened, maxStatesEnqueued, duration, 1.0, beamWidth
+                        "Beam Search", heuristicName, initialState, goal, N,
+                        tracePath(closedSet, initial, current.getState()), moves, totalSetOpened, maxStatesEnqueued, duration, 1.0, beamWidth
                     );
                 }
                 
-                return {true, moves, totalSetOpened, maxStatesEnqueued, duration, heuristic, "", 7, "Beam Search", false, "", beamWidth};
+                return {true, moves, totalSetOpened, maxStatesEnqueued, duration, heuristic, "", 7, "Beam Search", false, "", beamWidth, tieBreaking};
             }
             
             // Add current state to closed set
-            size_t currentHash = current->hash();
-            if (closedSet.find(currentHash) != closedSet.end()) {
+            bool inserted;
+            SearchEntry& entry = closedSet.findOrInsert(current.getState(), inserted);
+            if (!inserted) {
                 continue;
             }
-            closedSet.insert(currentHash);
+            entry.g = current.getCost();
+            entry.closed = true;
+            entry.move = current.getMove();
             totalSetOpened++;
-            
-            // Generate and process neighbors
-            getNeighbors(*current, neighbors);
-            
-            for (auto& neighbor : neighbors) {
-                // Calculate costs
-                int gCost = current->getCost() + 1;
-                int hCost = Heuristic::getHeuristicValue(neighbor.state, goalLookup, size, heuristic);
-                
-                // Create neighbor node
-                auto neighborNode = std::make_shared<Node>(
-                    std::move(neighbor.state),
-                    size,
-                    neighbor.zeroPos,
-                    gCost,
-                    hCost,
-                    current,          // Track parent for path reconstruction
-                    neighbor.action   // Track action that led to this state
-                );
-                
-                size_t neighborHash = neighborNode->hash();
-                
-                // Skip if already visited
-                if (closedSet.find(neighborHash) != closedSet.end()) {
-                    continue;
-                }
-                
-                // Add to candidates
-                candidates.push_back(neighborNode);
+            beam[expanding++] = current;
+        }
+        
+        // Expand contiguous slices of the beam in parallel, so the buffers
+        // concatenated in worker order keep the serial generation order
+        int workers = static_cast<int>(std::min<size_t>(threads,
+            std::max<size_t>(1, expanding / MIN_NODES_PER_THREAD)));
+        for (Expansion<N>& expansion : expansions) {
+            expansion.candidates.clear();
+            expansion.countByH.clear();
+        }
+        std::vector<std::thread> pool;
+        for (int w = 1; w < workers; w++) {
+            pool.emplace_back(expand<N>, std::cref(beam), expanding * w / workers,
+                              expanding * (w + 1) / workers, std::cref(closedSet),
+                              std::cref(estimator), std::ref(expansions[w]));
+        }
+        expand(beam, 0, expanding / workers, closedSet, estimator, expansions[0]);
+        for (std::thread& thread : pool) {
+            thread.join();
+        }
+        
+        // Merge: candidates per h over all workers
+        total.clear();
+        for (int w = 0; w < workers; w++) {
+            const std::vector<int>& counts = expansions[w].countByH;
+            total.resize(std::max(total.size(), counts.size()), 0);
+            for (size_t h = 0; h < counts.size(); h++) {
+                total[h] += counts[h];
             }
         }
         
         // If no candidates, search has failed
-        if (candidates.empty()) {
+        if (total.empty()) {
             auto endTime = std::chrono::high_resolution_clock::now();
             double duration = std::chrono::duration<double>(endTime - startTime).count();
             
@@ -292,22 +303,47 @@ BeamSearchResult BeamSearch::solve(Puzzle& puzzle, int size, int heuristic, bool
             }
             
             return {false, 0, totalSetOpened, maxStatesEnqueued, duration, heuristic, "", 
-                    7, "Beam Search", false, "Beam search exhausted (no candidates)", beamWidth};
+                    7, "Beam Search", false, "Beam search exhausted (no candidates)", beamWidth, tieBreaking};
         }
         
-        // Sort candidates by heuristic value (best first)
-        std::sort(candidates.begin(), candidates.end(), 
-                  [](const std::shared_ptr<Node>& a, const std::shared_ptr<Node>& b) {
-                      return a->getHeuristic() < b->getHeuristic();
-                  });
+        // Partial selection of the best k: h is a small integer, so counting
+        // per h gives the cut without sorting. kept[h] candidates of each h
+        // go to the next beam, lowest h first, at start[h]
+        kept.assign(total.size(), 0);
+        start.assign(total.size(), 0);
+        int room = beamWidth;
+        for (size_t h = 0; h < total.size(); h++) {
+            start[h] = beamWidth - room;
+            kept[h] = std::min(total[h], room);
+            room -= kept[h];
+        }
+        nextBeam.resize(beamWidth - room);
         
-        // Keep only the best k candidates for the next beam
-        int actualBeamWidth = std::min(beamWidth, static_cast<int>(candidates.size()));
-        beam.clear();
-        beam.reserve(actualBeamWidth);
-        for (int i = 0; i < actualBeamWidth; i++) {
-            beam.push_back(candidates[i]);
+        // Equal h keep generation order (high g, low h: one level shares g),
+        // newest first under LIFO
+        for (int w = 0; w < workers; w++) {
+            Expansion<N>& expansion = expansions[w];
+            expansion.rank.resize(total.size());
+            for (size_t h = 0; h < total.size(); h++) {
+                expansion.rank[h] = w == 0 ? 0
+                    : expansions[w - 1].rank[h]
+                      + (h < expansions[w - 1].countByH.size() ? expansions[w - 1].countByH[h] : 0);
+            }
         }
+        for (int w = 0; w < workers; w++) {
+            Expansion<N>& expansion = expansions[w];
+            for (const Node<N>& candidate : expansion.candidates) {
+                int h = candidate.getHeuristic();
+                int rank = expansion.rank[h]++;
+                if (tieBreaking == TIE_LIFO) {
+                    rank = total[h] - 1 - rank;
+                }
+                if (rank < kept[h]) {
+                    nextBeam[start[h] + rank] = candidate;
+                }
+            }
+        }
+        beam.swap(nextBeam);
         
         // Update max states in memory
         maxStatesEnqueued = std::max(maxStatesEnqueued, static_cast<int>(beam.size()));
@@ -330,6 +366,300 @@ BeamSearchResult BeamSearch::solve(Puzzle& puzzle, int size, int heuristic, bool
     }
     
     return {false, 0, totalSetOpened, maxStatesEnqueued, duration, heuristic, "", 
-            7, "Beam Search", false, "No solution found", beamWidth};
+            7, "Beam Search", false, "No solution found", beamWidth, tieBreaking};
+}
+
+template <int N>
+bool BeamSearch::LayerKey<N>::operator<(const LayerKey& other) const {
+    if (f != other.f) {
+        return f < other.f;
+    }
+    return state < other.state;
+}
+
+template <int N>
+BeamSearch::RunOutcome BeamSearch::beamStackRun(const State<N>& initial, uint8_t initialZeroPos,
+                                                const State<N>& goal, const Heuristic<N>& estimator,
+                                                int beamWidth, long long budget, size_t maxStates,
+                                                std::chrono::high_resolution_clock::time_point startTime,
+                                                double maxTimeSeconds, int& upperBound,
+                                                std::vector<uint8_t>& path, long long& expanded,
+                                                size_t& maxStored) {
+    const LayerKey<N> lowest = {INT_MIN, State<N>()};
+    const LayerKey<N> unbounded = {INT_MAX, State<N>()};
+    auto byKey = [](const Node<N>& a, const Node<N>& b) {
+        return LayerKey<N>{a.getFValue(), a.getState()} < LayerKey<N>{b.getFValue(), b.getState()};
+    };
+    
+    // States of the levels on the stack and the move that reached them: the
+    // duplicate check, and the path once the goal is generated
+    StateTable<N, SearchEntry> table(std::min(maxStates, static_cast<size_t>(beamWidth) * 64));
+    
+    // layers[i] is the beam of level i, stack[i] the range of its children
+    // allowed into level i + 1
+    std::vector<std::vector<Node<N>>> layers(1);
+    std::vector<BeamStackItem<N>> stack;
+    std::vector<Node<N>> candidates;
+    
+    HeuristicCache<N> initialCache;
+    int initialH = estimator.evaluate(initial, initialCache);
+    layers[0].emplace_back(initial, initialZeroPos, 0, initialH, initialCache);
+    bool startInserted;
+    SearchEntry& startEntry = table.findOrInsert(initial, startInserted);
+    startEntry.g = 0;
+    startEntry.closed = true;
+    startEntry.move = MOVE_UP;
+    stack.push_back({lowest, unbounded});
+    long long runExpanded = 0;
+    
+    while (true) {
+        size_t level = stack.size() - 1;
+        const BeamStackItem<N> item = stack.back();
+        candidates.clear();
+        
+        for (const Node<N>& current : layers[level]) {
+            if (runExpanded >= budget) {
+                return RUN_BUDGET_SPENT;
+            }
+            runExpanded++;
+            expanded++;
+            if (maxTimeSeconds > 0 && runExpanded % TIME_CHECK_INTERVAL == 0) {
+                double elapsed = std::chrono::duration<double>(
+                    std::chrono::high_resolution_clock::now() - startTime).count();
+                if (elapsed > maxTimeSeconds) {
+                    return RUN_TIMEOUT;
+                }
+            }
+            
+            uint8_t zeroPos = current.getZeroPos();
+            int g = current.getCost() + 1;
+            for (int move = 0; move < MOVE_COUNT; move++) {
+                int newZeroPos = Board<N>::NEIGHBORS[zeroPos][move];
+                if (newZeroPos == Board<N>::NO_CELL) {
+                    continue;
+                }
+                State<N> child = current.getState();
+                child.slide(zeroPos, newZeroPos);
+                
+                // A better solution: trace it while its levels are on the stack
+                if (child == goal) {
+                    if (g < upperBound) {
+                        upperBound = g;
+                        bool goalInserted;
+                        table.findOrInsert(goal, goalInserted).move = move;
+                        path = tracePath(table, initial, goal);
+                        table.erase(goal);
+                    }
+                    continue;
+                }
+                
+                // Already on the stack, at this level or above
+                if (table.find(child) != nullptr) {
+                    continue;
+                }
+                
+                HeuristicCache<N> cache;
+                int hCost = estimator.evaluateMove(child, zeroPos, move, current.getHeuristicCache(), cache);
+                LayerKey<N> key = {g + hCost, child};
+                if (key.f >= upperBound || key < item.low || !(key < item.high)) {
+                    continue;
+                }
+                
+                if (table.size() >= maxStates) {
+                    return RUN_MEMORY_LIMIT;
+                }
+                bool inserted;
+                SearchEntry& entry = table.findOrInsert(child, inserted);
+                entry.g = g;
+                entry.closed = true;
+                entry.move = move;
+                candidates.emplace_back(child, static_cast<uint8_t>(newZeroPos), g, hCost, cache,
+                                        static_cast<uint8_t>(move));
+            }
+        }
+        
+        // Keep the best k; the first pruned key is where the next visit of
+        // this level resumes
+        if (candidates.size() > static_cast<size_t>(beamWidth)) {
+            std::nth_element(candidates.begin(), candidates.begin() + beamWidth, candidates.end(), byKey);
+            stack.back().high = LayerKey<N>{candidates[beamWidth].getFValue(), candidates[beamWidth].getState()};
+            for (size_t i = beamWidth; i < candidates.size(); i++) {
+                table.erase(candidates[i].getState());
+            }
+            candidates.resize(beamWidth);
+        }
+        
+        if (!candidates.empty()) {
+            if (layers.size() == level + 1) {
+                layers.emplace_back();
+            }
+            layers[level + 1].swap(candidates);
+            stack.push_back({lowest, unbounded});
+            maxStored = std::max(maxStored, table.size());
+            continue;
+        }
+        
+        // Dead end: drop the levels whose ranges are all explored below the
+        // upper bound, then move the deepest other one to its next range
+        while (!stack.empty() && stack.back().high.f >= upperBound) {
+            for (const Node<N>& node : layers[stack.size() - 1]) {
+                table.erase(node.getState());
+            }
+            layers[stack.size() - 1].clear();
+            stack.pop_back();
+        }
+        if (stack.empty()) {
+            return RUN_COMPLETE;
+        }
+        stack.back().low = stack.back().high;
+        stack.back().high = unbounded;
+    }
+}
+
+template <int N>
+BeamSearchResult BeamSearch::solveBeamStack(Puzzle& puzzle, int heuristic, bool silent,
+                                            size_t maxStates, double maxTimeSeconds, int beamWidth) {
+    auto startTime = std::chrono::high_resolution_clock::now();
+    
+    // Get initial state and goal
+    const std::vector<uint8_t>& initialState = puzzle.getGrid();
+    const std::vector<uint8_t>& goal = puzzle.getGoal();
+    
+    // Packed search representation of the start and goal boards
+    const State<N> initial(initialState);
+    const State<N> goalState(goal);
+    
+    // Display memory and time limits (set by Game class)
+    if (!silent) {
+        size_t estimatedMB = estimateMemoryUsage<N>(maxStates) / (1024 * 1024);
+        std::cout << "\n[Memory Safety] Max states limited to " << maxStates 
+                 << " (~" << estimatedMB << " MB)\n";
+        std::cout << "[Time Safety] Max execution time: " << maxTimeSeconds << " seconds\n";
+        std::cout << "[Beam-stack] Initial beam width (k): " << beamWidth << ", doubled while unproven\n";
+    }
+    
+    // Check if already at goal
+    if (isGoal(initial, goalState)) {
+        if (!silent) {
+            std::cout << "\nPuzzle is already solved!\n";
+        }
+        auto endTime = std::chrono::high_resolution_clock::now();
+        double duration = std::chrono::duration<double>(endTime - startTime).count();
+        
+        return {true, 0, 0, 0, duration, heuristic, "", 15, "Beam-stack Search", false, "", beamWidth, -1};
+    }
+    
+    // Check if puzzle is solvable
+    if (!puzzle.isSolvable()) {
+        if (!silent) {
+            std::cout << "\nPuzzle is unsolvable!\n";
+        }
+        auto endTime = std::chrono::high_resolution_clock::now();
+        double duration = std::chrono::duration<double>(endTime - startTime).count();
+        
+        return {false, 0, 0, 0, duration, heuristic, "", 15, "Beam-stack Search", false, "Puzzle is unsolvable", beamWidth, -1};
+    }
+    
+    // Goal lookup and per-move delta tables, built once per goal and heuristic
+    const Heuristic<N>& estimator = Heuristic<N>::get(goal, heuristic);
+    
+    // Find initial blank position
+    uint8_t initialZeroPos = static_cast<uint8_t>(
+        std::find(initialState.begin(), initialState.end(), 0) - initialState.begin());
+    HeuristicCache<N> initialCache;
+    int initialH = estimator.evaluate(initial, initialCache);
+    
+    // Iterative widening: each run starts over with twice the width and twice
+    // the budget, only the upper bound and its path carry over
+    int upperBound = INT_MAX;
+    std::vector<uint8_t> path;
+    long long expanded = 0;
+    size_t maxStored = 0;
+    int width = beamWidth;
+    long long budget = WIDENING_BUDGET * width * std::max(initialH, 1);
+    RunOutcome outcome;
+    
+    while (true) {
+        outcome = beamStackRun(initial, initialZeroPos, goalState, estimator, width, budget, maxStates,
+                               startTime, maxTimeSeconds, upperBound, path, expanded, maxStored);
+        
+        if (!silent) {
+            std::cout << "[Beam-stack] k = " << width << ": ";
+            if (path.empty()) {
+                std::cout << "no solution yet";
+            } else {
+                std::cout << path.size() << " moves";
+            }
+            std::cout << (outcome == RUN_COMPLETE ? ", proven optimal"
+                         : outcome == RUN_BUDGET_SPENT ? ", budget spent, widening" : ", stopped")
+                     << " (" << expanded << " states opened)\n";
+        }
+        
+        if (outcome != RUN_BUDGET_SPENT || width > INT_MAX / 2) {
+            break;
+        }
+        width *= 2;
+        budget *= 2;
+    }
+    
+    auto endTime = std::chrono::high_resolution_clock::now();
+    double duration = std::chrono::duration<double>(endTime - startTime).count();
+    int totalSetOpened = static_cast<int>(std::min<long long>(expanded, INT_MAX));
+    int maxStatesEnqueued = static_cast<int>(maxStored);
+    std::string reason = outcome == RUN_TIMEOUT ? "Timeout reached"
+                       : outcome == RUN_MEMORY_LIMIT ? "Memory limit reached"
+                       : outcome == RUN_BUDGET_SPENT ? "Beam width limit reached" : "";
+    
+    if (!path.empty()) {
+        int moves = static_cast<int>(path.size());
+        
+        if (!silent) {
+            std::cout << "\n" << std::string(50, '=') << "\n";
+            std::cout << "Solution found!\n";
+            std::cout << std::string(50, '=') << "\n";
+            std::cout << "Total moves required: " << moves << "\n";
+            std::cout << "Total states opened (time complexity): " << totalSetOpened << "\n";
+            std::cout << "Maximum states in memory (space complexity): " << maxStatesEnqueued << "\n";
+            std::cout << "Beam width (k): " << width << "\n";
+            std::cout << "Optimal: " << (outcome == RUN_COMPLETE ? "yes (search completed)"
+                                                                 : "not proven (" + reason + ")") << "\n";
+            std::cout << "Execution time: " << std::fixed << std::setprecision(4) 
+                     << duration << "s\n";
+            std::cout << std::string(50, '=') << "\n";
+            
+            SolutionLogger::logSolution(
+                "Beam-stack Search", getHeuristicName(heuristic), initialState, goal, N,
+                path, moves, totalSetOpened, maxStatesEnqueued, duration, 1.0, width
+            );
+        }
+        
+        return {true, moves, totalSetOpened, maxStatesEnqueued, duration, heuristic, "", 
+                15, "Beam-stack Search", false, "", width, -1};
+    }
+    
+    if (!silent) {
+        std::cout << "\n" << std::string(50, '=') << "\n";
+        if (outcome == RUN_TIMEOUT) {
+            std::cout << "⏱️  TIMEOUT REACHED!\n";
+        } else if (outcome == RUN_MEMORY_LIMIT) {
+            std::cout << "⚠️  MEMORY LIMIT REACHED!\n";
+        } else {
+            std::cout << "No solution found! Puzzle may be unsolvable.\n";
+        }
+        std::cout << std::string(50, '=') << "\n";
+        std::cout << "Explored " << totalSetOpened << " states\n";
+        std::cout << "Maximum states in memory: " << maxStatesEnqueued << "\n";
+        std::cout << "Beam width (k): " << width << "\n";
+        std::cout << "Execution time: " << std::fixed << std::setprecision(4) 
+                 << duration << "s\n";
+    }
+    
+    return {false, 0, totalSetOpened, maxStatesEnqueued, duration, heuristic, "", 
+            15, "Beam-stack Search", outcome == RUN_MEMORY_LIMIT,
+            reason.empty() ? "No solution found" : reason, width, -1};
 }
 
+#define INSTANTIATE_BEAMSEARCH(N) \
+    template BeamSearchResult BeamSearch::solve<N>(Puzzle&, int, bool, size_t, double, int, int, TieBreaking); \
+    template BeamSearchResult BeamSearch::solveBeamStack<N>(Puzzle&, int, bool, size_t, double, int);
+NPUZZLE_FOR_EACH_SIZE(INSTANTIATE_BEAMSEARCH)
@@ -0,0 +1,325 @@
+#include "../includes/BidirectionalSearch.hpp"
+#include "../includes/SolutionLogger.hpp"
+#include <iostream>
+#include <chrono>
+#include <iomanip>
+#include <algorithm>
+#include <climits>
+
+BidirectionalSearch::BidirectionalSearch() {}
+
+BidirectionalSearch::~BidirectionalSearch() {}
+
+BidirectionalSearch::BidirectionalSearch(const BidirectionalSearch& other) {
+    (void)other;
+}
+
+BidirectionalSearch& BidirectionalSearch::operator=(const BidirectionalSearch& other) {
+    (void)other;
+    return *this;
+}
+
+template <int N>
+BidirectionalSearch::Frontier<N>::Frontier(const std::vector<uint8_t>& target, int heuristic,
+                                           size_t maxStates)
+    : estimator(target, heuristic), table(maxStates / 2), open(), openG(), openF(),
+      minG(INT_MAX), minF(INT_MAX), expanded(0) {}
+
+template <int N>
+void BidirectionalSearch::push(Frontier<N>& side, Node<N>* node) {
+    int g = node->getCost();
+    int f = node->getFValue();
+    if (static_cast<int>(side.openF.size()) <= f) {
+        side.openG.resize(f + 1, 0);
+        side.openF.resize(f + 1, 0);
+    }
+    side.openG[g]++;
+    side.openF[f]++;
+    side.minG = std::min(side.minG, g);
+    side.minF = std::min(side.minF, f);
+    side.open.push(node);
+}
+
+template <int N>
+bool BidirectionalSearch::dropStale(Frontier<N>& side) {
+    // Nodes superseded by a shorter path stay in the heap until they surface
+    while (!side.open.empty()) {
+        const Node<N>* top = side.open.top();
+        const SearchEntry* entry = side.table.find(top->getState());
+        if (!entry->closed && top->getCost() == entry->g) {
+            return true;
+        }
+        side.open.pop();
+    }
+    return false;
+}
+
+int BidirectionalSearch::lowest(const std::vector<int>& counts, int& mark) {
+    while (mark < static_cast<int>(counts.size()) && counts[mark] == 0) {
+        mark++;
+    }
+    if (mark >= static_cast<int>(counts.size())) {
+        mark = INT_MAX;
+    }
+    return mark;
+}
+
+template <int N>
+void BidirectionalSearch::expand(Frontier<N>& side, Frontier<N>& other,
+                                 NodeArena<Node<N>>& nodes, int& bestCost, State<N>& meeting) {
+    Node<N>* current = side.open.top();
+    side.open.pop();
+
+    side.table.find(current->getState())->closed = true;
+    side.openG[current->getCost()]--;
+    side.openF[current->getFValue()]--;
+    side.expanded++;
+
+    const State<N>& state = current->getState();
+    int zeroPos = current->getZeroPos();
+    int gCost = current->getCost() + 1;
+
+    for (int move = 0; move < MOVE_COUNT; move++) {
+        int newZeroPos = Board<N>::NEIGHBORS[zeroPos][move];
+        if (newZeroPos == Board<N>::NO_CELL) {
+            continue;
+        }
+        State<N> newState = state;
+        newState.slide(zeroPos, newZeroPos);
+
+        // Same skip-or-reopen rule as A*
+        bool inserted;
+        SearchEntry& entry = side.table.findOrInsert(newState, inserted);
+        if (!inserted && entry.g <= gCost) {
+            continue;
+        }
+
+        HeuristicCache<N> cache;
+        int hCost = side.estimator.evaluateMove(newState, zeroPos, move,
+                                                current->getHeuristicCache(), cache);
+
+        // The node it supersedes is no longer counted as open
+        if (!inserted && !entry.closed) {
+            side.openG[entry.g]--;
+            side.openF[entry.g + hCost]--;
+        }
+        entry.g = gCost;
+        entry.closed = false;
+        entry.move = static_cast<uint8_t>(move);
+
+        push(side, nodes.create(newState, static_cast<uint8_t>(newZeroPos), gCost, hCost, cache));
+
+        // The other search reached this state too: a full path
+        const SearchEntry* otherEntry = other.table.find(newState);
+        if (otherEntry && gCost + otherEntry->g < bestCost) {
+            bestCost = gCost + otherEntry->g;
+            meeting = newState;
+        }
+    }
+}
+
+template <int N>
+AStarResult BidirectionalSearch::solve(Puzzle& puzzle, int heuristic, bool silent,
+                                       size_t maxStates, double maxTimeSeconds) {
+    auto startTime = std::chrono::high_resolution_clock::now();
+
+    // Get initial state and goal
+    const std::vector<uint8_t>& initialState = puzzle.getGrid();
+    const std::vector<uint8_t>& goal = puzzle.getGoal();
+
+    // Packed search representation of the start and goal boards
+    const State<N> initial(initialState);
+    const State<N> goalState(goal);
+
+    // Display memory and time limits (set by Game class)
+    if (!silent) {
+        // Arena node, open-list pointer and table slot per state, as in A*
+        size_t bytesPerState = sizeof(Node<N>) + sizeof(Node<N>*)
+                               + StateTable<N, SearchEntry>::bytesPerEntry();
+        size_t estimatedMB = maxStates * bytesPerState / (1024 * 1024);
+        std::cout << "\n[Memory Safety] Max states limited to " << maxStates
+                 << " (~" << estimatedMB << " MB, both directions)\n";
+        std::cout << "[Time Safety] Max execution time: " << maxTimeSeconds << " seconds\n";
+    }
+
+    // Check if already at goal
+    if (initial == goalState) {
+        if (!silent) {
+            std::cout << "\nPuzzle is already solved!\n";
+        }
+        auto endTime = std::chrono::high_resolution_clock::now();
+        double duration = std::chrono::duration<double>(endTime - startTime).count();
+
+        return {true, 0, 0, 0, duration, heuristic, "", 9, "Bidirectional MM", false, "", 1.0};
+    }
+
+    // Check if puzzle is solvable
+    if (!puzzle.isSolvable()) {
+        if (!silent) {
+            std::cout << "\nPuzzle is unsolvable!\n";
+
+            // Log failure to file
+            std::string heuristicName = getHeuristicName(heuristic);
+
+            SolutionLogger::logFailure(
+                "Bidirectional MM", heuristicName, initialState, goal, N,
+                "Puzzle is unsolvable", 0, 0, 0
+            );
+        }
+        auto endTime = std::chrono::high_resolution_clock::now();
+        double duration = std::chrono::duration<double>(endTime - startTime).count();
+
+        return {false, 0, 0, 0, duration, heuristic, "", 9, "Bidirectional MM", false,
+                "Puzzle is unsolvable", 1.0};
+    }
+
+    // Forward search is guided toward the goal, backward search toward the start
+    Frontier<N> forward(goal, heuristic, maxStates);
+    Frontier<N> backward(initialState, heuristic, maxStates);
+
+    // All nodes of this search live in one arena, released in one shot on return
+    NodeArena<Node<N>> nodes;
+
+    // Seed each direction with its own start
+    const std::vector<uint8_t>* roots[2] = {&initialState, &goal};
+    Frontier<N>* sides[2] = {&forward, &backward};
+    for (int i = 0; i < 2; i++) {
+        const State<N> root(*roots[i]);
+        uint8_t zeroPos = static_cast<uint8_t>(
+            std::find(roots[i]->begin(), roots[i]->end(), 0) - roots[i]->begin());
+        HeuristicCache<N> cache;
+        int h = sides[i]->estimator.evaluate(root, cache);
+
+        bool inserted;
+        sides[i]->table.findOrInsert(root, inserted) = SearchEntry{0, false, MOVE_UP};
+        push(*sides[i], nodes.create(root, zeroPos, 0, h, cache));
+    }
+
+    // Initialize statistics
+    int totalSetOpened = 0;
+    int maxStatesEnqueued = 0;
+    int bestCost = INT_MAX;
+    State<N> meeting;
+
+    std::string failureReason = "No solution found";
+    bool memoryLimitReached = false;
+
+    // Either list running dry means its side has seen every reachable state
+    while (dropStale(forward) && dropStale(backward)) {
+        maxStatesEnqueued = std::max(maxStatesEnqueued,
+                                     static_cast<int>(forward.open.size() + backward.open.size()));
+
+        // Lower bound on any path not found yet: the smallest priority, the
+        // smallest f on either side, and the smallest g of each side plus
+        // the one move at least that still separates them
+        int forwardPriority = MeetInMiddleComparator::priority(forward.open.top());
+        int backwardPriority = MeetInMiddleComparator::priority(backward.open.top());
+        int lowerBound = std::max(std::min(forwardPriority, backwardPriority),
+                                  std::max(lowest(forward.openF, forward.minF),
+                                           lowest(backward.openF, backward.minF)));
+        lowerBound = std::max(lowerBound, lowest(forward.openG, forward.minG)
+                                          + lowest(backward.openG, backward.minG) + 1);
+        if (bestCost <= lowerBound) {
+            break;
+        }
+
+        // Timeout check - prevent infinite execution
+        if (maxTimeSeconds > 0) {
+            auto currentTime = std::chrono::high_resolution_clock::now();
+            double elapsed = std::chrono::duration<double>(currentTime - startTime).count();
+            if (elapsed > maxTimeSeconds) {
+                failureReason = "Timeout reached";
+                break;
+            }
+        }
+
+        // Memory limit check - every node created stays in the arena until
+        // the search returns, so count those rather than expansions
+        if (nodes.size() >= maxStates) {
+            failureReason = "Memory limit reached";
+            memoryLimitReached = true;
+            break;
+        }
+
+        // MM always expands the side holding the smaller priority
+        if (forwardPriority <= backwardPriority) {
+            expand(forward, backward, nodes, bestCost, meeting);
+        } else {
+            expand(backward, forward, nodes, bestCost, meeting);
+        }
+        totalSetOpened++;
+    }
+
+    auto endTime = std::chrono::high_resolution_clock::now();
+    double duration = std::chrono::duration<double>(endTime - startTime).count();
+
+    // A meeting is only proven optimal when the loop stopped on the bound or
+    // ran out of states to expand
+    if (bestCost != INT_MAX && failureReason == "No solution found") {
+        int moves = bestCost;
+
+        if (!silent) {
+            std::cout << "\n" << std::string(50, '=') << "\n";
+            std::cout << "Solution found!\n";
+            std::cout << std::string(50, '=') << "\n";
+            std::cout << "Total moves required: " << moves << "\n";
+            std::cout << "Total states opened (time complexity): " << totalSetOpened << "\n";
+            std::cout << "  Forward: " << forward.expanded << ", backward: " << backward.expanded << "\n";
+            std::cout << "Maximum states in memory (space complexity): " << maxStatesEnqueued << "\n";
+            std::cout << "Execution time: " << std::fixed << std::setprecision(4)
+                     << duration << "s\n";
+            std::cout << std::string(50, '=') << "\n";
+
+            // Start to meeting point, then the backward search's moves undone
+            // in reverse order from the meeting point to the goal
+            std::vector<uint8_t> path = tracePath(forward.table, initial, meeting);
+            std::vector<uint8_t> back = tracePath(backward.table, goalState, meeting);
+            for (auto it = back.rbegin(); it != back.rend(); ++it) {
+                path.push_back(static_cast<uint8_t>(*it ^ 1));
+            }
+
+            // Log solution to file
+            std::string heuristicName = getHeuristicName(heuristic);
+
+            SolutionLogger::logSolution(
+                "Bidirectional MM", heuristicName, initialState, goal, N,
+                path, moves, totalSetOpened, maxStatesEnqueued, duration
+            );
+        }
+
+        return {true, moves, totalSetOpened, maxStatesEnqueued, duration, heuristic, "",
+                9, "Bidirectional MM", false, "", 1.0};
+    }
+
+    if (!silent) {
+        std::cout << "\n" << std::string(50, '=') << "\n";
+        if (failureReason == "Timeout reached") {
+            std::cout << "⏱️  TIMEOUT REACHED!\n";
+        } else if (memoryLimitReached) {
+            std::cout << "⚠️  MEMORY LIMIT REACHED!\n";
+        } else {
+            std::cout << "No solution found! Puzzle may be unsolvable.\n";
+        }
+        std::cout << std::string(50, '=') << "\n";
+        std::cout << "Explored " << totalSetOpened << " states (forward: " << forward.expanded
+                  << ", backward: " << backward.expanded << ")\n";
+        std::cout << "Maximum states in memory: " << maxStatesEnqueued << "\n";
+        std::cout << "Execution time: " << std::fixed << std::setprecision(4)
+                 << duration << "s\n";
+
+        // Log failure to file
+        std::string heuristicName = getHeuristicName(heuristic);
+
+        SolutionLogger::logFailure(
+            "Bidirectional MM", heuristicName, initialState, goal, N,
+            failureReason, totalSetOpened, maxStatesEnqueued, duration
+        );
+    }
+
+    return {false, 0, totalSetOpened, maxStatesEnqueued, duration, heuristic, "",
+            9, "Bidirectional MM", memoryLimitReached, failureReason, 1.0};
+}
+
+#define INSTANTIATE_BIDIRECTIONAL(N) \
+    template AStarResult BidirectionalSearch::solve<N>(Puzzle&, int, bool, size_t, double);
+NPUZZLE_FOR_EACH_SIZE(INSTANTIATE_BIDIRECTIONAL)
@@ -0,0 +1,10 @@
+#include "../includes/BucketQueue.hpp"
+
+std::string getTieBreakingName(int policy) {
+    switch (policy) {
+        case TIE_HIGH_G: return "high g";
+        case TIE_LOW_H: return "low h";
+        case TIE_LIFO: return "LIFO";
+        default: return "none";
+    }
+}
@@ -0,0 +1,726 @@
+#include "../includes/CommandLine.hpp"
+#include "../includes/Game.hpp"
+#include "../includes/PatternDatabase.hpp"
+#include "../includes/StateTable.hpp"
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <thread>
+#include <algorithm>
+#include <chrono>
+
+CommandLine::CommandLine() {
+    _options.size = 3;
+    _options.sizeSet = false;
+    _options.file = "";
+    _options.batch = "";
+    _options.jobs = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+    _options.seeded = false;
+    _options.seed = 0;
+    _options.iterations = 10000;
+    _options.solvable = true;
+    _options.algorithm = 1;
+    _options.heuristic = -1;
+    _options.weight = 0;
+    _options.beamWidth = 100;
+    _options.threads = 0;
+    _options.tieBreaking = TIE_HIGH_G;
+    _options.memoryBudgetMB = ExternalAstar::DEFAULT_MEMORY_MB;
+    _options.maxTimeSeconds = Game::DEFAULT_MAX_TIME;
+    _options.maxStates = Game::DEFAULT_MAX_STATES;
+    _options.maxStatesSet = false;
+    _options.format = FORMAT_TEXT;
+    _options.verbose = false;
+    _options.help = false;
+}
+
+CommandLine::~CommandLine() {}
+
+CommandLine::CommandLine(const CommandLine& other) : _options(other._options) {}
+
+CommandLine& CommandLine::operator=(const CommandLine& other) {
+    if (this != &other) {
+        _options = other._options;
+    }
+    return *this;
+}
+
+void CommandLine::printUsage(std::ostream& out, const char* program) {
+    out << "Usage: " << program << " [options]\n"
+        << "       " << program << " --generate-pdb [encoding]\n"
+        << "Without options the game asks for every choice interactively.\n"
+        << "\n"
+        << "Board:\n"
+        << "  -s, --size N             Board size, 3 to 8 (default: 3)\n"
+        << "  -f, --file PATH          Read the board from a file instead: the size, then\n"
+        << "                           one row of tiles per line, 0 = blank, # comments\n"
+        << "      --seed N             Seed of the random shuffle (default: current time)\n"
+        << "      --iterations N       Random blank moves from the goal (default: 10000)\n"
+        << "      --unsolvable         Generate an unsolvable board\n"
+        << "  -b, --batch PATH         Solve every board of a file (- = stdin): one board per\n"
+        << "                           line, or boards in the --file layout one after another\n"
+        << "  -J, --jobs N             Boards solved at once by --batch (default: all cores)\n"
+        << "\n"
+        << "Search:\n"
+        << "  -a, --algorithm NAME     astar, ucs, greedy, weighted-astar, beam, ida, mm,\n"
+        << "                           hda, epea, frontier-astar, external-astar, ara,\n"
+        << "                           beam-stack, or the menu number (default: astar)\n"
+        << "  -H, --heuristic NAME     manhattan, hamming, linear-conflict, pdb-555,\n"
+        << "                           pdb-663, walking-distance, wd-lc, or the id\n"
+        << "                           (default: linear-conflict)\n"
+        << "      --pdb-encoding NAME  byte, nibble, mod3 or min-blank (default: nibble)\n"
+        << "  -w, --weight X           Weighted A* weight, ARA* starting weight, 0.1 to 10\n"
+        << "  -k, --beam-width N       Beam width, first width of beam-stack (default: 100)\n"
+        << "  -j, --threads N          Workers of beam, ida and hda per board (default: all\n"
+        << "                           cores, 1 with --batch)\n"
+        << "      --tie-breaking NAME  high-g, low-h or lifo (default: high-g)\n"
+        << "      --memory-mb N        RAM budget of external-astar, 16 to 65536 (default: "
+        << ExternalAstar::DEFAULT_MEMORY_MB << ")\n"
+        << "\n"
+        << "Limits and output:\n"
+        << "  -t, --time-limit SEC     Give up on a board after SEC seconds (default: " << Game::DEFAULT_MAX_TIME << ")\n"
+        << "  -m, --max-states N       Give up after N stored states (default: " << Game::DEFAULT_MAX_STATES << ",\n"
+        << "                           split over the jobs of --batch)\n"
+        << "  -o, --format NAME        text, json or csv (default: text)\n"
+        << "  -v, --verbose            Print the solver's own report and log to results/\n"
+        << "  -h, --help               Show this help\n"
+        << "\n"
+        << "Exit status: 0 solved (every board of a batch), 1 not solved, 2 bad arguments\n"
+        << "or board file.\n";
+}
+
+template <typename T>
+bool CommandLine::parseValue(const std::string& text, T& value) {
+    std::istringstream iss(text);
+    iss >> value;
+    return !iss.fail() && iss.eof();
+}
+
+bool CommandLine::parseAlgorithm(const std::string& name, int& algorithm) {
+    // Same numbering as the algorithm menu
+    static const char* const names[] = {
+        "astar", "ucs", "greedy", "weighted-astar", "beam", "ida", "mm",
+        "hda", "epea", "frontier-astar", "external-astar", "ara", "beam-stack"
+    };
+    static const int count = sizeof(names) / sizeof(names[0]);
+
+    for (int i = 0; i < count; i++) {
+        if (name == names[i]) {
+            algorithm = i + 1;
+            return true;
+        }
+    }
+    return parseValue(name, algorithm) && algorithm >= 1 && algorithm <= count;
+}
+
+bool CommandLine::parseHeuristic(const std::string& name, int& heuristic) {
+    // Same ids as getHeuristicName (4 is not a heuristic of its own)
+    static const char* const names[] = {
+        "manhattan", "hamming", "linear-conflict", "", "pdb-555", "pdb-663",
+        "walking-distance", "wd-lc"
+    };
+    static const int count = sizeof(names) / sizeof(names[0]);
+
+    for (int i = 0; i < count; i++) {
+        if (names[i][0] != '\0' && name == names[i]) {
+            heuristic = i + 1;
+            return true;
+        }
+    }
+    return parseValue(name, heuristic) && heuristic >= 1 && heuristic <= count && heuristic != 4;
+}
+
+bool CommandLine::parseTieBreaking(const std::string& name, TieBreaking& tieBreaking) {
+    if (name == "high-g") {
+        tieBreaking = TIE_HIGH_G;
+    } else if (name == "low-h") {
+        tieBreaking = TIE_LOW_H;
+    } else if (name == "lifo") {
+        tieBreaking = TIE_LIFO;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+bool CommandLine::parseFormat(const std::string& name, Format& format) {
+    if (name == "text") {
+        format = FORMAT_TEXT;
+    } else if (name == "json") {
+        format = FORMAT_JSON;
+    } else if (name == "csv") {
+        format = FORMAT_CSV;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+bool CommandLine::parse(int argc, char** argv) {
+    for (int i = 1; i < argc; i++) {
+        std::string flag = argv[i];
+        std::string value;
+        bool inlineValue = false;
+
+        // --flag=value is the same as --flag value
+        size_t equals = flag.find('=');
+        if (flag.compare(0, 2, "--") == 0 && equals != std::string::npos) {
+            value = flag.substr(equals + 1);
+            flag = flag.substr(0, equals);
+            inlineValue = true;
+        }
+
+        // Switches take no value
+        if (flag == "-h" || flag == "--help") {
+            _options.help = true;
+            continue;
+        } else if (flag == "-v" || flag == "--verbose") {
+            _options.verbose = true;
+            continue;
+        } else if (flag == "--unsolvable") {
+            _options.solvable = false;
+            continue;
+        }
+
+        bool missing = false;
+        if (!inlineValue) {
+            if (i + 1 < argc) {
+                value = argv[++i];
+            } else {
+                missing = true;
+            }
+        }
+
+        long long number = 0;
+        bool ok = true;
+        if (flag == "-s" || flag == "--size") {
+            ok = parseValue(value, number) && number >= NPUZZLE_MIN_SIZE && number <= NPUZZLE_MAX_SIZE;
+            _options.size = static_cast<int>(number);
+            _options.sizeSet = true;
+        } else if (flag == "-f" || flag == "--file") {
+            ok = !value.empty();
+            _options.file = value;
+        } else if (flag == "-b" || flag == "--batch") {
+            ok = !value.empty();
+            _options.batch = value;
+        } else if (flag == "-J" || flag == "--jobs") {
+            ok = parseValue(value, number) && number >= 1 && number <= 256;
+            _options.jobs = static_cast<int>(number);
+        } else if (flag == "--seed") {
+            ok = parseValue(value, number) && number >= 0 && number <= 0xFFFFFFFFLL;
+            _options.seeded = true;
+            _options.seed = static_cast<unsigned int>(number);
+        } else if (flag == "--iterations") {
+            ok = parseValue(value, number) && number >= 0 && number <= 2000000000LL;
+            _options.iterations = static_cast<int>(number);
+        } else if (flag == "-a" || flag == "--algorithm") {
+            ok = parseAlgorithm(value, _options.algorithm);
+        } else if (flag == "-H" || flag == "--heuristic") {
+            ok = parseHeuristic(value, _options.heuristic);
+        } else if (flag == "--pdb-encoding") {
+            PatternDatabase::Encoding encoding;
+            ok = PatternDatabase::parseEncoding(value, encoding);
+            if (ok) {
+                PatternDatabase::setEncoding(encoding);
+            }
+        } else if (flag == "-w" || flag == "--weight") {
+            ok = parseValue(value, _options.weight) && _options.weight >= 0.1 && _options.weight <= 10.0;
+        } else if (flag == "-k" || flag == "--beam-width") {
+            ok = parseValue(value, number) && number >= 1 && number <= 1000000;
+            _options.beamWidth = static_cast<int>(number);
+        } else if (flag == "-j" || flag == "--threads") {
+            ok = parseValue(value, number) && number >= 1 && number <= 256;
+            _options.threads = static_cast<int>(number);
+        } else if (flag == "--tie-breaking") {
+            ok = parseTieBreaking(value, _options.tieBreaking);
+        } else if (flag == "--memory-mb") {
+            ok = parseValue(value, number) && number >= static_cast<long long>(ExternalAstar::MIN_MEMORY_MB)
+                 && number <= 65536;
+            _options.memoryBudgetMB = static_cast<size_t>(number);
+        } else if (flag == "-t" || flag == "--time-limit") {
+            ok = parseValue(value, _options.maxTimeSeconds) && _options.maxTimeSeconds > 0;
+        } else if (flag == "-m" || flag == "--max-states") {
+            ok = parseValue(value, number) && number >= 1;
+            _options.maxStates = static_cast<size_t>(number);
+            _options.maxStatesSet = true;
+        } else if (flag == "-o" || flag == "--format") {
+            ok = parseFormat(value, _options.format);
+        } else {
+            std::cerr << "npuzzle: unknown option " << flag << "\n";
+            return false;
+        }
+
+        if (missing) {
+            std::cerr << "npuzzle: missing value for " << flag << "\n";
+            return false;
+        } else if (!ok) {
+            std::cerr << "npuzzle: invalid value for " << flag << ": " << value << "\n";
+            return false;
+        }
+    }
+    return true;
+}
+
+bool CommandLine::validate() {
+    int algorithm = _options.algorithm;
+
+    bool generated = _options.seeded || !_options.solvable || _options.sizeSet;
+    if (!_options.file.empty() && !_options.batch.empty()) {
+        std::cerr << "npuzzle: --file and --batch cannot be combined\n";
+        return false;
+    } else if ((!_options.file.empty() || !_options.batch.empty()) && generated) {
+        std::cerr << "npuzzle: --size, --seed and --unsolvable only apply to generated boards\n";
+        return false;
+    } else if (!_options.batch.empty() && _options.verbose) {
+        std::cerr << "npuzzle: --verbose is not available with --batch\n";
+        return false;
+    }
+
+    // Same heuristic rules as the heuristic menu
+    if (algorithm == 2) {
+        // UCS - no heuristic (uses only g(n))
+        _options.heuristic = 0;
+    } else if (_options.heuristic == -1) {
+        _options.heuristic = 3;
+    }
+
+    if (_options.weight == 0) {
+        // Defaults of the weight prompt
+        _options.weight = algorithm == 12 ? WeightedAstar::DEFAULT_ANYTIME_WEIGHT : 1.5;
+    }
+
+    if (_options.threads == 0) {
+        // A batch already keeps every core busy with one puzzle each
+        _options.threads = !_options.batch.empty() ? 1
+                           : std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+    }
+    if (!_options.batch.empty() && !_options.maxStatesSet) {
+        // The default state limit is for the whole batch, split over the jobs
+        _options.maxStates = std::max<size_t>(1, _options.maxStates / _options.jobs);
+    }
+    return true;
+}
+
+bool CommandLine::supportsHeuristic(int size) const {
+    if (PatternDatabase::isPatternHeuristic(_options.heuristic)
+        && (size != PatternDatabase::SIZE || _options.algorithm == 7)) {
+        std::cerr << "npuzzle: pattern databases need a " << PatternDatabase::SIZE << "x"
+                  << PatternDatabase::SIZE << " board and an algorithm other than mm\n";
+        return false;
+    } else if ((_options.heuristic == 7 || _options.heuristic == 8) && size > WalkingDistance::MAX_SIZE) {
+        std::cerr << "npuzzle: walking distance is only available up to "
+                  << WalkingDistance::MAX_SIZE << "x" << WalkingDistance::MAX_SIZE << "\n";
+        return false;
+    }
+    return true;
+}
+
+bool CommandLine::readBoards(std::istream& in, const std::string& name,
+                             std::vector<std::vector<uint8_t>>& boards) {
+    // Numbers of every line, anything after a # is a comment
+    std::vector<std::vector<long long>> rows;
+    std::vector<int> lineNumbers;
+    std::string line;
+    for (int lineNumber = 1; std::getline(in, line); lineNumber++) {
+        size_t comment = line.find('#');
+        if (comment != std::string::npos) {
+            line.erase(comment);
+        }
+        std::istringstream iss(line);
+        std::vector<long long> row;
+        std::string token;
+        while (iss >> token) {
+            long long number;
+            if (!parseValue(token, number)) {
+                std::cerr << "npuzzle: " << name << ":" << lineNumber << ": not a number: " << token << "\n";
+                return false;
+            }
+            row.push_back(number);
+        }
+        if (!row.empty()) {
+            rows.push_back(row);
+            lineNumbers.push_back(lineNumber);
+        }
+    }
+
+    size_t r = 0;
+    while (r < rows.size()) {
+        int lineNumber = lineNumbers[r];
+        std::vector<long long> tiles;
+        long long size = 0;
+
+        if (rows[r].size() == 1) {
+            // Subject layout: the size alone, then one row of tiles per line
+            size = rows[r][0];
+            if (size < NPUZZLE_MIN_SIZE || size > NPUZZLE_MAX_SIZE) {
+                std::cerr << "npuzzle: " << name << ":" << lineNumber << ": size must be between "
+                          << NPUZZLE_MIN_SIZE << " and " << NPUZZLE_MAX_SIZE << "\n";
+                return false;
+            }
+            for (long long k = 1; k <= size; k++) {
+                if (r + k >= rows.size() || rows[r + k].size() != static_cast<size_t>(size)) {
+                    std::cerr << "npuzzle: " << name << ":" << lineNumber << ": expected " << size
+                              << " rows of " << size << " tiles\n";
+                    return false;
+                }
+                tiles.insert(tiles.end(), rows[r + k].begin(), rows[r + k].end());
+            }
+            r += static_cast<size_t>(size) + 1;
+        } else {
+            // One board per line, the size given by the number of tiles
+            while ((size + 1) * (size + 1) <= static_cast<long long>(rows[r].size())) {
+                size++;
+            }
+            if (size * size != static_cast<long long>(rows[r].size())
+                || size < NPUZZLE_MIN_SIZE || size > NPUZZLE_MAX_SIZE) {
+                std::cerr << "npuzzle: " << name << ":" << lineNumber << ": " << rows[r].size()
+                          << " tiles is not a board of " << NPUZZLE_MIN_SIZE << "x" << NPUZZLE_MIN_SIZE
+                          << " to " << NPUZZLE_MAX_SIZE << "x" << NPUZZLE_MAX_SIZE << "\n";
+                return false;
+            }
+            tiles = rows[r];
+            r++;
+        }
+
+        // Each tile exactly once
+        std::vector<bool> seen(tiles.size(), false);
+        std::vector<uint8_t> grid(tiles.size(), 0);
+        for (size_t i = 0; i < tiles.size(); i++) {
+            long long tile = tiles[i];
+            if (tile < 0 || tile >= static_cast<long long>(tiles.size()) || seen[tile]) {
+                std::cerr << "npuzzle: " << name << ":" << lineNumber << ": invalid or repeated tile "
+                          << tile << "\n";
+                return false;
+            }
+            seen[tile] = true;
+            grid[i] = static_cast<uint8_t>(tile);
+        }
+        boards.push_back(grid);
+    }
+
+    if (boards.empty()) {
+        std::cerr << "npuzzle: " << name << ": no board\n";
+        return false;
+    }
+    return true;
+}
+
+bool CommandLine::loadBoards(const std::string& path, std::vector<std::vector<uint8_t>>& boards) {
+    if (path == "-") {
+        return readBoards(std::cin, "<stdin>", boards);
+    }
+    std::ifstream file(path.c_str());
+    if (!file) {
+        std::cerr << "npuzzle: cannot open " << path << "\n";
+        return false;
+    }
+    return readBoards(file, path, boards);
+}
+
+template <typename Result>
+CommandLine::Report CommandLine::toReport(const Result& result) {
+    return {result.solved, result.moves, result.timeComplexity, result.spaceComplexity,
+            result.executionTime, result.algorithmName, result.heuristicName,
+            result.memoryLimitReached, result.failureReason};
+}
+
+template <int N>
+CommandLine::Report CommandLine::runSolver(Puzzle& puzzle) const {
+    // Same engines and arguments as Game::runSolver, with the limits of the flags
+    bool silent = !_options.verbose;
+    int heuristic = _options.heuristic;
+    size_t maxStates = _options.maxStates;
+    double maxTime = _options.maxTimeSeconds;
+    TieBreaking tieBreaking = _options.tieBreaking;
+
+    switch (_options.algorithm) {
+        case 1:
+            return toReport(Astar().solve<N>(puzzle, heuristic, silent, maxStates, maxTime, tieBreaking));
+        case 2:
+            return toReport(UCS().solve<N>(puzzle, silent, maxStates, maxTime, tieBreaking));
+        case 3:
+            return toReport(Greedy().solve<N>(puzzle, heuristic, silent, maxStates, maxTime, tieBreaking));
+        case 4:
+            return toReport(WeightedAstar().solve<N>(puzzle, heuristic, silent, maxStates, maxTime,
+                                                     _options.weight, tieBreaking));
+        case 5:
+            return toReport(BeamSearch().solve<N>(puzzle, heuristic, silent, maxStates, maxTime,
+                                                  _options.beamWidth, _options.threads, tieBreaking));
+        case 6:
+            return toReport(IDAstar().solve<N>(puzzle, heuristic, silent, maxTime, _options.threads));
+        case 7:
+            return toReport(BidirectionalSearch().solve<N>(puzzle, heuristic, silent, maxStates, maxTime));
+        case 8:
+            return toReport(HDAstar().solve<N>(puzzle, heuristic, silent, maxStates, maxTime,
+                                               _options.threads, tieBreaking));
+        case 9:
+            return toReport(EPEAstar().solve<N>(puzzle, heuristic, silent, maxStates, maxTime, tieBreaking));
+        case 10:
+            return toReport(FrontierAstar().solve<N>(puzzle, heuristic, silent, maxStates, maxTime,
+                                                     tieBreaking));
+        case 11:
+            return toReport(ExternalAstar().solve<N>(puzzle, heuristic, silent, maxTime,
+                                                     _options.memoryBudgetMB));
+        case 12:
+            return toReport(WeightedAstar().solveAnytime<N>(puzzle, heuristic, silent, maxStates, maxTime,
+                                                            _options.weight, WeightedAstar::DEFAULT_WEIGHT_STEP,
+                                                            tieBreaking));
+        default:
+            return toReport(BeamSearch().solveBeamStack<N>(puzzle, heuristic, silent, maxStates, maxTime,
+                                                           _options.beamWidth));
+    }
+}
+
+CommandLine::Report CommandLine::solve(Puzzle& puzzle) const {
+    // Dispatch once to the engines specialised for this board size
+    Report report;
+    switch (puzzle.getSize()) {
+        case 3: report = runSolver<3>(puzzle); break;
+        case 4: report = runSolver<4>(puzzle); break;
+        case 5: report = runSolver<5>(puzzle); break;
+        case 6: report = runSolver<6>(puzzle); break;
+        case 7: report = runSolver<7>(puzzle); break;
+        default: report = runSolver<8>(puzzle); break;
+    }
+
+    // Engines only fill in the heuristic name when they print their own report
+    report.heuristicName = getHeuristicName(_options.heuristic);
+    return report;
+}
+
+void CommandLine::solveBatch(const std::vector<std::vector<uint8_t>>& boards, std::vector<Report>& reports,
+                             std::atomic<size_t>& next) const {
+    // Each job takes the next unsolved board until none are left
+    for (size_t i = next++; i < boards.size(); i = next++) {
+        Puzzle puzzle(boardSize(boards[i]), true, 0);
+        puzzle.setGrid(boards[i]);
+        reports[i] = solve(puzzle);
+    }
+}
+
+std::string CommandLine::jsonEscape(const std::string& text) {
+    std::string escaped;
+    for (size_t i = 0; i < text.size(); i++) {
+        char c = text[i];
+        if (c == '"' || c == '\\') {
+            escaped += '\\';
+            escaped += c;
+        } else if (c == '\n') {
+            escaped += "\\n";
+        } else {
+            escaped += c;
+        }
+    }
+    return escaped;
+}
+
+std::string CommandLine::csvField(const std::string& text) {
+    // Quoted only when it holds a separator or a quote
+    if (text.find_first_of(",\"\n") == std::string::npos) {
+        return text;
+    }
+    std::string quoted = "\"";
+    for (size_t i = 0; i < text.size(); i++) {
+        if (text[i] == '"') {
+            quoted += '"';
+        }
+        quoted += text[i];
+    }
+    return quoted + "\"";
+}
+
+int CommandLine::boardSize(const std::vector<uint8_t>& board) {
+    int size = 0;
+    while (size * size < static_cast<int>(board.size())) {
+        size++;
+    }
+    return size;
+}
+
+std::string CommandLine::jsonRecord(const std::vector<uint8_t>& board, const Report& report) {
+    std::ostringstream record;
+    record << "{\"size\": " << boardSize(board) << ", \"board\": [";
+    for (size_t i = 0; i < board.size(); i++) {
+        record << (i ? ", " : "") << static_cast<int>(board[i]);
+    }
+    record << "], \"algorithm\": \"" << jsonEscape(report.algorithmName) << "\""
+           << ", \"heuristic\": \"" << jsonEscape(report.heuristicName) << "\""
+           << ", \"solved\": " << (report.solved ? "true" : "false")
+           << ", \"moves\": " << report.moves
+           << ", \"time_complexity\": " << report.timeComplexity
+           << ", \"space_complexity\": " << report.spaceComplexity
+           << ", \"execution_time\": " << std::fixed << std::setprecision(6) << report.executionTime
+           << ", \"memory_limit_reached\": " << (report.memoryLimitReached ? "true" : "false")
+           << ", \"failure_reason\": \"" << jsonEscape(report.failureReason) << "\"}";
+    return record.str();
+}
+
+std::string CommandLine::csvRecord(const std::vector<uint8_t>& board, const Report& report) {
+    std::ostringstream record;
+    record << boardSize(board) << ",";
+    for (size_t i = 0; i < board.size(); i++) {
+        record << (i ? " " : "") << static_cast<int>(board[i]);
+    }
+    record << "," << csvField(report.algorithmName) << "," << csvField(report.heuristicName) << ","
+           << (report.solved ? 1 : 0) << "," << report.moves << ","
+           << report.timeComplexity << "," << report.spaceComplexity << ","
+           << std::fixed << std::setprecision(6) << report.executionTime << ","
+           << (report.memoryLimitReached ? 1 : 0) << "," << csvField(report.failureReason);
+    return record.str();
+}
+
+void CommandLine::printReport(const std::vector<uint8_t>& board, const Report& report) const {
+    if (_options.format == FORMAT_JSON) {
+        std::cout << jsonRecord(board, report) << "\n";
+    } else if (_options.format == FORMAT_CSV) {
+        std::cout << CSV_HEADER << "\n" << csvRecord(board, report) << "\n";
+    } else {
+        int size = boardSize(board);
+        std::cout << "Size: " << size << "x" << size << "\n"
+                  << "Board:";
+        for (size_t i = 0; i < board.size(); i++) {
+            std::cout << " " << static_cast<int>(board[i]);
+        }
+        std::cout << "\n"
+                  << "Algorithm: " << report.algorithmName << "\n"
+                  << "Heuristic: " << report.heuristicName << "\n"
+                  << "Solved: " << (report.solved ? "yes" : "no") << "\n"
+                  << "Moves: " << report.moves << "\n"
+                  << "Time complexity: " << report.timeComplexity << "\n"
+                  << "Space complexity: " << report.spaceComplexity << "\n"
+                  << "Execution time: " << std::fixed << std::setprecision(6) << report.executionTime << "s\n";
+        if (!report.solved) {
+            std::cout << "Failure: " << report.failureReason
+                      << (report.memoryLimitReached ? " (memory limit)" : "") << "\n";
+        }
+    }
+}
+
+void CommandLine::printBatch(const std::vector<std::vector<uint8_t>>& boards,
+                             const std::vector<Report>& reports, int jobs, double wallTime) const {
+    size_t solved = 0;
+    double solverTime = 0;
+    for (size_t i = 0; i < reports.size(); i++) {
+        solved += reports[i].solved ? 1 : 0;
+        solverTime += reports[i].executionTime;
+    }
+
+    if (_options.format == FORMAT_JSON) {
+        std::cout << std::fixed << std::setprecision(6)
+                  << "{\"puzzles\": " << boards.size() << ", \"solved\": " << solved
+                  << ", \"jobs\": " << jobs << ", \"solver_time\": " << solverTime
+                  << ", \"wall_time\": " << wallTime << ", \"results\": [\n";
+        for (size_t i = 0; i < boards.size(); i++) {
+            std::cout << "  " << jsonRecord(boards[i], reports[i]) << (i + 1 < boards.size() ? ",\n" : "\n");
+        }
+        std::cout << "]}\n";
+    } else if (_options.format == FORMAT_CSV) {
+        std::cout << "index," << CSV_HEADER << "\n";
+        for (size_t i = 0; i < boards.size(); i++) {
+            std::cout << i + 1 << "," << csvRecord(boards[i], reports[i]) << "\n";
+        }
+    } else {
+        std::cout << std::fixed << std::setprecision(6);
+        for (size_t i = 0; i < boards.size(); i++) {
+            const Report& report = reports[i];
+            int size = boardSize(boards[i]);
+            std::cout << "#" << i + 1 << " " << size << "x" << size << ": ";
+            if (report.solved) {
+                std::cout << report.moves << " moves, time " << report.timeComplexity
+                          << ", space " << report.spaceComplexity << ", " << report.executionTime << "s\n";
+            } else {
+                std::cout << "not solved, " << report.failureReason << ", " << report.executionTime << "s\n";
+            }
+        }
+        std::cout << std::setprecision(2)
+                  << "Algorithm: " << (reports.empty() ? "" : reports[0].algorithmName) << "\n"
+                  << "Heuristic: " << getHeuristicName(_options.heuristic) << "\n"
+                  << "Solved: " << solved << " of " << boards.size() << "\n"
+                  << "Jobs: " << jobs << "\n"
+                  << "Solver time: " << solverTime << "s, wall time " << wallTime << "s\n";
+    }
+}
+
+int CommandLine::runBatch() {
+    std::vector<std::vector<uint8_t>> boards;
+    if (!loadBoards(_options.batch, boards)) {
+        return 2;
+    }
+    for (size_t i = 0; i < boards.size(); i++) {
+        if (!supportsHeuristic(boardSize(boards[i]))) {
+            return 2;
+        }
+    }
+
+    // Every job solves whole boards; the estimator tables of each size are
+    // built by the first solve that needs them and shared by all the others.
+    // State tables start small and grow instead of each solve zeroing a large one.
+    StateTablePreallocation::bytes = StateTablePreallocation::BATCH_BYTES;
+    std::vector<Report> reports(boards.size());
+    std::atomic<size_t> next(0);
+    int jobs = static_cast<int>(std::min<size_t>(_options.jobs, boards.size()));
+    auto startTime = std::chrono::high_resolution_clock::now();
+
+    std::vector<std::thread> pool;
+    for (int i = 1; i < jobs; i++) {
+        pool.emplace_back(&CommandLine::solveBatch, this, std::cref(boards), std::ref(reports), std::ref(next));
+    }
+    solveBatch(boards, reports, next);
+    for (std::thread& thread : pool) {
+        thread.join();
+    }
+
+    double wallTime = std::chrono::duration<double>(
+        std::chrono::high_resolution_clock::now() - startTime).count();
+    printBatch(boards, reports, jobs, wallTime);
+
+    for (size_t i = 0; i < reports.size(); i++) {
+        if (!reports[i].solved) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+int CommandLine::run(int argc, char** argv) {
+    if (!parse(argc, argv)) {
+        std::cerr << "Try '" << argv[0] << " --help' for more information.\n";
+        return 2;
+    }
+    if (_options.help) {
+        printUsage(std::cout, argv[0]);
+        return 0;
+    }
+    if (!validate()) {
+        return 2;
+    }
+    if (!_options.batch.empty()) {
+        return runBatch();
+    }
+
+    Puzzle puzzle(_options.size, _options.solvable, _options.iterations);
+    if (!_options.file.empty()) {
+        std::vector<std::vector<uint8_t>> boards;
+        if (!loadBoards(_options.file, boards)) {
+            return 2;
+        } else if (boards.size() != 1) {
+            std::cerr << "npuzzle: " << _options.file << " holds " << boards.size()
+                      << " boards, solve them with --batch\n";
+            return 2;
+        }
+        puzzle = Puzzle(boardSize(boards[0]), true, 0);
+        puzzle.setGrid(boards[0]);
+    } else if (_options.seeded) {
+        puzzle.generatePuzzle(_options.seed);
+    } else {
+        puzzle.generatePuzzle();
+    }
+    if (!supportsHeuristic(puzzle.getSize())) {
+        return 2;
+    }
+
+    Report report = solve(puzzle);
+    printReport(puzzle.getGrid(), report);
+    return report.solved ? 0 : 1;
+}
@@ -1,8 +1,12 @@
 #include "../includes/Display.hpp"
+#include "../includes/Board.hpp"
+#include "../includes/BucketQueue.hpp"
 #include <iostream>
 #include <iomanip>
 #include <sstream>
 #include <limits>
+#include <algorithm>
+#include <thread>
 
 // ANSI color codes
 #define RESET   "\033[0m"
@@ -91,7 +95,8 @@ int Display::promptForGridSize() {
     int size;
     while (true) {
         std::cout << BOLD << YELLOW << "Enter the grid size" << RESET 
-                  << DIM << " (must be > 2 but more than 5 is insane)" << RESET << " [default: 3]: ";
+                  << DIM << " (" << NPUZZLE_MIN_SIZE << " to " << NPUZZLE_MAX_SIZE
+                  << ", but more than 5 is insane)" << RESET << " [default: 3]: ";
         
         std::string input;
         std::getline(std::cin, input);
@@ -106,10 +111,10 @@ int Display::promptForGridSize() {
             }
         }
         
-        if (size <= 2) {
+        if (size < NPUZZLE_MIN_SIZE || size > NPUZZLE_MAX_SIZE) {
             std::cout << BOLD << RED << "✗" << RESET 
-                      << " Size must be strictly bigger than 2. You entered: " 
-                      << RED << size << RESET << "\n";
+                      << " Size must be between " << NPUZZLE_MIN_SIZE << " and " << NPUZZLE_MAX_SIZE
+                      << ". You entered: " << RED << size << RESET << "\n";
             continue;
         }
         
@@ -245,6 +250,14 @@ int Display::promptForAlgorithm() {
         "Greedy Search (Fast, not optimal)",
         "Weighted A* (Configurable speed/optimality trade-off)",
         "Beam Search (Memory-efficient for large puzzles)",
+        "IDA* (Optimal, memory grows only with solution length)",
+        "Bidirectional MM (Optimal, searches from the start and the goal)",
+        "HDA* (Optimal, parallel A* with states hashed to worker threads)",
+        "EPEA* (Optimal, generates only the children it will expand)",
+        "Frontier A* (Optimal, forgets expanded states to save memory)",
+        "External A* (Optimal, spills search layers to disk beyond RAM)",
+        "ARA* (Anytime Weighted A*, improves its solution until the time limit)",
+        "Beam-stack Search (Complete beam search, backtracks and widens k until optimal)",
     };
     
     std::cout << "\n" << BOLD << YELLOW << "Available Algorithms:" << RESET << "\n";
@@ -280,21 +293,27 @@ int Display::promptForAlgorithm() {
         break;
     }
     
-    return choice;  // Returns 1=A*, 2=UCS, 3=Greedy, 4=Weighted A*, 5=Beam Search
+    return choice;  // Returns 1=A*, 2=UCS, 3=Greedy, 4=Weighted A*, 5=Beam Search, 6=IDA*, 7=Bidirectional MM, 8=HDA*, 9=EPEA*, 10=Frontier A*, 11=External A*, 12=ARA*, 13=Beam-stack
 }
 
-int Display::promptForHeuristic(int algorithm) {
+int Display::promptForHeuristic(int algorithm, int size) {
     std::vector<std::string> options;
     
     // Different heuristics available depending on the algorithm
-    if (algorithm == 1) {
-        // A* - all heuristics available
+    if (algorithm == 1 || algorithm >= 6) {
+        // A* and its variants (IDA*, MM, HDA*, EPEA*, frontier, external, ARA*,
+        // beam-stack) - all heuristics available
         options = {
             "Manhattan Distance",
             "Hamming Distance",
             "Linear Conflict (Best overall)",
         };
-        std::cout << "\n" << BOLD << YELLOW << "Select Heuristic for A*:" << RESET << "\n";
+        std::cout << "\n" << BOLD << YELLOW << "Select Heuristic for "
+                  << (algorithm == 6 ? "IDA*" : algorithm == 7 ? "Bidirectional MM"
+                      : algorithm == 8 ? "HDA*" : algorithm == 9 ? "EPEA*"
+                      : algorithm == 10 ? "Frontier A*" : algorithm == 11 ? "External A*"
+                      : algorithm == 12 ? "ARA*" : algorithm == 13 ? "Beam-stack Search" : "A*")
+                  << ":" << RESET << "\n";
     } else if (algorithm == 2) {
         // UCS - no heuristic needed (uses only g(n))
         std::cout << "\n" << BOLD << CYAN << "ℹ  UCS doesn't use a heuristic (h(n) = 0)" << RESET << "\n";
@@ -328,6 +347,29 @@ int Display::promptForHeuristic(int algorithm) {
         options = {"Manhattan Distance"};
     }
     
+    // Heuristic id behind each menu entry
+    std::vector<int> ids;
+    for (size_t i = 0; i < options.size(); i++) {
+        ids.push_back(static_cast<int>(i) + 1);
+    }
+    
+    // Pattern databases are only built for the 4x4 board, and only toward
+    // the snail goal (the backward search of MM would need one per start)
+    if (size == 4 && options.size() > 1 && algorithm != 7) {
+        options.push_back("Pattern Database 5-5-5 (4x4, builds in ~1s)");
+        ids.push_back(5);
+        options.push_back("Pattern Database 6-6-3 (4x4, strongest, builds in ~12s)");
+        ids.push_back(6);
+    }
+    
+    // Walking distance tables stay small up to 4x4 (5x5 would need ~65M patterns)
+    if (size <= 4 && options.size() > 1) {
+        options.push_back("Walking Distance (up to 4x4)");
+        ids.push_back(7);
+        options.push_back("Walking Distance + Linear Conflict (max of both)");
+        ids.push_back(8);
+    }
+    
     for (size_t i = 0; i < options.size(); i++) {
         std::cout << "  " << CYAN << (i + 1) << RESET << ". " << options[i] << "\n";
     }
@@ -360,24 +402,25 @@ int Display::promptForHeuristic(int algorithm) {
         break;
     }
     
-    return choice;  // Returns 1-3 depending on algorithm and choice
+    return ids[choice - 1];  // 1-3, or 5-6 for the 4x4 pattern databases
 }
 
-double Display::promptForWeight() {
+double Display::promptForWeight(double defaultWeight) {
     std::cout << "\n" << BOLD << YELLOW << "Weighted A* Configuration:" << RESET << "\n";
     std::cout << "  " << CYAN << "Weight controls the balance between optimality and speed" << RESET << "\n";
     std::cout << "  • weight = 1.0: Standard A* (optimal, slower)\n";
     std::cout << "  • weight > 1.0: Faster but suboptimal (e.g., 1.5, 2.0, 5.0)\n";
+    std::cout << "  • ARA*: starting weight, lowered after each solution down to 1.0\n";
     
     double weight;
     while (true) {
-        std::cout << "\n" << BOLD << YELLOW << "Enter weight" << RESET << " [default: 1.5]: ";
+        std::cout << "\n" << BOLD << YELLOW << "Enter weight" << RESET << " [default: " << defaultWeight << "]: ";
         
         std::string input;
         std::getline(std::cin, input);
         
         if (input.empty()) {
-            weight = 1.5;
+            weight = defaultWeight;
         } else {
             std::istringstream iss(input);
             if (!(iss >> weight)) {
@@ -399,11 +442,51 @@ double Display::promptForWeight() {
     return weight;
 }
 
+int Display::promptForPatternEncoding() {
+    std::cout << "\n" << BOLD << YELLOW << "Pattern Database Storage:" << RESET << "\n";
+    std::cout << "  " << CYAN << "Smaller tables leave more memory for the search itself" << RESET << "\n";
+    std::cout << "  1. byte       exact           (5-5-5: 16 MB, 6-6-3: 110 MB)\n";
+    std::cout << "  2. nibble     exact           (5-5-5:  8 MB, 6-6-3:  55 MB)\n";
+    std::cout << "  3. mod3       exact, slower   (5-5-5:  4 MB, 6-6-3:  27 MB)\n";
+    std::cout << "  4. min-blank  weaker, lossy   (5-5-5: 1.5 MB, 6-6-3: 11 MB)\n";
+    
+    int choice;
+    while (true) {
+        std::cout << "\n" << BOLD << YELLOW << "Enter storage" << RESET << " [default: 2]: ";
+        
+        std::string input;
+        std::getline(std::cin, input);
+        
+        if (input.empty()) {
+            choice = 2;
+        } else {
+            std::istringstream iss(input);
+            if (!(iss >> choice)) {
+                std::cout << BOLD << RED << "✗" << RESET << " Invalid input. Please enter a valid number.\n";
+                continue;
+            }
+        }
+        
+        if (choice < 1 || choice > 4) {
+            std::cout << BOLD << RED << "✗" << RESET << " Please enter a number between 1 and 4\n";
+            continue;
+        }
+        
+        std::cout << BOLD << GREEN << "✓" << RESET << " Using storage: " 
+                  << BOLD << CYAN << choice << RESET << "\n";
+        break;
+    }
+    
+    // 0 = byte, 1 = nibble, 2 = mod3, 3 = min-blank (PatternDatabase::Encoding)
+    return choice - 1;
+}
+
 int Display::promptForBeamWidth() {
     std::cout << "\n" << BOLD << YELLOW << "Beam Search Configuration:" << RESET << "\n";
     std::cout << "  " << CYAN << "Beam width (k) controls the number of best states kept at each level" << RESET << "\n";
     std::cout << "  • Smaller k (e.g., 10-50): Faster but may miss solution\n";
     std::cout << "  • Larger k (e.g., 100-1000): More thorough but slower\n";
+    std::cout << "  • Wide k (e.g., 10000-100000): Large boards, best with several threads\n";
     
     int beamWidth;
     while (true) {
@@ -422,8 +505,8 @@ int Display::promptForBeamWidth() {
             }
         }
         
-        if (beamWidth < 1 || beamWidth > 10000) {
-            std::cout << BOLD << RED << "✗" << RESET << " Beam width should be between 1 and 10000\n";
+        if (beamWidth < 1 || beamWidth > 1000000) {
+            std::cout << BOLD << RED << "✗" << RESET << " Beam width should be between 1 and 1000000\n";
             continue;
         }
         
@@ -435,6 +518,125 @@ int Display::promptForBeamWidth() {
     return beamWidth;
 }
 
+int Display::promptForThreads() {
+    // One worker per hardware thread unless told otherwise
+    int defaultThreads = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+    
+    std::cout << "\n" << BOLD << YELLOW << "Parallel Search Configuration:" << RESET << "\n";
+    std::cout << "  " << CYAN << "IDA*: worker threads search subtrees under each bound, stealing work when idle" << RESET << "\n";
+    std::cout << "  " << CYAN << "HDA*: each worker thread owns the states whose hash maps to it" << RESET << "\n";
+    std::cout << "  " << CYAN << "Beam Search: worker threads expand slices of each level's beam" << RESET << "\n";
+    std::cout << "  • 1 thread: Single-threaded search\n";
+    std::cout << "  • More threads: Faster on hard puzzles, same optimal solution\n";
+    
+    int threads;
+    while (true) {
+        std::cout << "\n" << BOLD << YELLOW << "Enter number of threads" << RESET 
+                  << " [default: " << defaultThreads << "]: ";
+        
+        std::string input;
+        std::getline(std::cin, input);
+        
+        if (input.empty()) {
+            threads = defaultThreads;
+        } else {
+            std::istringstream iss(input);
+            if (!(iss >> threads)) {
+                std::cout << BOLD << RED << "✗" << RESET << " Invalid input. Please enter a valid number.\n";
+                continue;
+            }
+        }
+        
+        if (threads < 1 || threads > 256) {
+            std::cout << BOLD << RED << "✗" << RESET << " Threads should be between 1 and 256\n";
+            continue;
+        }
+        
+        std::cout << BOLD << GREEN << "✓" << RESET << " Using threads: " 
+                  << BOLD << CYAN << threads << RESET << "\n";
+        break;
+    }
+    
+    return threads;
+}
+
+int Display::promptForTieBreaking() {
+    std::cout << "\n" << BOLD << YELLOW << "Tie-Breaking:" << RESET << "\n";
+    std::cout << "  " << CYAN << "Which state to expand first among those with equal priority" << RESET << "\n";
+    std::cout << "  1. high g     deepest first, fewest states on most boards\n";
+    std::cout << "  2. low h      closest to the goal first\n";
+    std::cout << "  3. LIFO       most recently generated first\n";
+    
+    int choice;
+    while (true) {
+        std::cout << "\n" << BOLD << YELLOW << "Enter tie-breaking" << RESET << " [default: 1]: ";
+        
+        std::string input;
+        std::getline(std::cin, input);
+        
+        if (input.empty()) {
+            choice = 1;
+        } else {
+            std::istringstream iss(input);
+            if (!(iss >> choice)) {
+                std::cout << BOLD << RED << "✗" << RESET << " Invalid input. Please enter a valid number.\n";
+                continue;
+            }
+        }
+        
+        if (choice < 1 || choice > 3) {
+            std::cout << BOLD << RED << "✗" << RESET << " Please enter a number between 1 and 3\n";
+            continue;
+        }
+        
+        std::cout << BOLD << GREEN << "✓" << RESET << " Using tie-breaking: " 
+                  << BOLD << CYAN << getTieBreakingName(choice - 1) << RESET << "\n";
+        break;
+    }
+    
+    // 0 = high g, 1 = low h, 2 = LIFO (TieBreaking)
+    return choice - 1;
+}
+
+int Display::promptForMemoryBudget() {
+    int defaultBudget = 256;
+    
+    std::cout << "\n" << BOLD << YELLOW << "External Memory Configuration:" << RESET << "\n";
+    std::cout << "  " << CYAN << "RAM used to sort each search layer before it is written to disk (ddd/)" << RESET << "\n";
+    std::cout << "  • Small budget: More sorted runs on disk, more merging\n";
+    std::cout << "  • Large budget: Fewer runs, faster layers\n";
+    
+    int budget;
+    while (true) {
+        std::cout << "\n" << BOLD << YELLOW << "Enter RAM budget in MB" << RESET 
+                  << " [default: " << defaultBudget << "]: ";
+        
+        std::string input;
+        std::getline(std::cin, input);
+        
+        if (input.empty()) {
+            budget = defaultBudget;
+        } else {
+            std::istringstream iss(input);
+            if (!(iss >> budget)) {
+                std::cout << BOLD << RED << "✗" << RESET << " Invalid input. Please enter a valid number.\n";
+                continue;
+            }
+        }
+        
+        if (budget < 16 || budget > 65536) {
+            std::cout << BOLD << RED << "✗" << RESET << " RAM budget should be between 16 and 65536 MB\n";
+            continue;
+        }
+        
+        std::cout << BOLD << GREEN << "✓" << RESET << " Using RAM budget: " 
+                  << BOLD << CYAN << budget << " MB" << RESET << "\n";
+        break;
+    }
+    
+    return budget;
+}
+
 int Display::promptForIterations() {
     // Size-based defaults for reasonable difficulty
     int defaultIterations = 10000;
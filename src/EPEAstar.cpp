@@ -0,0 +1,325 @@
+#include "../includes/EPEAstar.hpp"
+#include "../includes/SolutionLogger.hpp"
+#include "../includes/StateTable.hpp"
+#include "../includes/NodeArena.hpp"
+#include <iostream>
+#include <chrono>
+#include <iomanip>
+#include <algorithm>
+#include <climits>
+
+EPEAstar::EPEAstar() {}
+
+EPEAstar::~EPEAstar() {}
+
+EPEAstar::EPEAstar(const EPEAstar& other) {
+    (void)other;
+}
+
+EPEAstar& EPEAstar::operator=(const EPEAstar& other) {
+    (void)other;
+    return *this;
+}
+
+template <int N>
+std::vector<int8_t> EPEAstar::buildOperatorTable(const Heuristic<N>& estimator) {
+    std::vector<int8_t> table(Board<N>::CELLS * MOVE_COUNT * Board<N>::CELLS, 0);
+    if (!estimator.isTileSum()) {
+        return table;
+    }
+    for (int blank = 0; blank < Board<N>::CELLS; blank++) {
+        for (int move = 0; move < MOVE_COUNT; move++) {
+            if (Board<N>::NEIGHBORS[blank][move] == Board<N>::NO_CELL) {
+                continue;
+            }
+            for (int tile = 1; tile < Board<N>::CELLS; tile++) {
+                // One more move, plus the change of the tile's distance
+                table[(blank * MOVE_COUNT + move) * Board<N>::CELLS + tile] = static_cast<int8_t>(
+                    1 + estimator.moveDelta(static_cast<uint8_t>(tile), blank, move));
+            }
+        }
+    }
+    return table;
+}
+
+template <int N>
+AStarResult EPEAstar::solve(Puzzle& puzzle, int heuristic, bool silent, size_t maxStates,
+                            double maxTimeSeconds, TieBreaking tieBreaking) {
+    auto startTime = std::chrono::high_resolution_clock::now();
+
+    // Get initial state and goal
+    const std::vector<uint8_t>& initialState = puzzle.getGrid();
+    const std::vector<uint8_t>& goal = puzzle.getGoal();
+
+    // Packed search representation of the start and goal boards
+    const State<N> initial(initialState);
+    const State<N> goalState(goal);
+
+    // Display memory and time limits (set by Game class)
+    if (!silent) {
+        // Same per-state cost as A*; the gain is in how many states get stored
+        size_t bytesPerState = sizeof(Node<N>) + sizeof(Node<N>*)
+                               + StateTable<N, SearchEntry>::bytesPerEntry();
+        size_t estimatedMB = maxStates * bytesPerState / (1024 * 1024);
+        std::cout << "\n[Memory Safety] Max states limited to " << maxStates
+                 << " (~" << estimatedMB << " MB)\n";
+        std::cout << "[Time Safety] Max execution time: " << maxTimeSeconds << " seconds\n";
+    }
+
+    // Check if already at goal
+    if (initial == goalState) {
+        if (!silent) {
+            std::cout << "\nPuzzle is already solved!\n";
+        }
+        auto endTime = std::chrono::high_resolution_clock::now();
+        double duration = std::chrono::duration<double>(endTime - startTime).count();
+
+        return {true, 0, 0, 0, duration, heuristic, "", 11, "EPEA*", false, "", 1.0, {}, tieBreaking};
+    }
+
+    // Check if puzzle is solvable
+    if (!puzzle.isSolvable()) {
+        if (!silent) {
+            std::cout << "\nPuzzle is unsolvable!\n";
+
+            // Log failure to file
+            std::string heuristicName = getHeuristicName(heuristic);
+
+            SolutionLogger::logFailure(
+                "EPEA*", heuristicName, initialState, goal, N,
+                "Puzzle is unsolvable", 0, 0, 0
+            );
+        }
+        auto endTime = std::chrono::high_resolution_clock::now();
+        double duration = std::chrono::duration<double>(endTime - startTime).count();
+
+        return {false, 0, 0, 0, duration, heuristic, "", 11, "EPEA*", false, "Puzzle is unsolvable", 1.0, {}, tieBreaking};
+    }
+
+    // Goal lookup and per-move delta tables, built once per goal and heuristic
+    const Heuristic<N>& estimator = Heuristic<N>::get(goal, heuristic);
+    const bool selectByTable = estimator.isTileSum();
+    const std::vector<int8_t> operators = buildOperatorTable(estimator);
+
+    // Initialize statistics
+    int totalSetOpened = 0;         // Distinct states expanded, comparable with A*
+    long long expansions = 0;       // Including the partial re-expansions
+    int maxStatesEnqueued = 0;
+
+    // Find initial blank position
+    uint8_t initialZeroPos = 0;
+    for (size_t i = 0; i < initialState.size(); i++) {
+        if (initialState[i] == 0) {
+            initialZeroPos = static_cast<uint8_t>(i);
+            break;
+        }
+    }
+
+    HeuristicCache<N> initialCache;
+    int initialH = estimator.evaluate(initial, initialCache);
+
+    // All nodes of this search live in one arena, released in one shot on return
+    NodeArena<Node<N>> nodes;
+    BucketQueue<Node<N>*> openSet(tieBreaking);
+    openSet.push(nodes.create(initial, initialZeroPos, 0, initialH, initialCache));
+
+    StateTable<N, SearchEntry> table(maxStates);
+    bool startInserted;
+    table.findOrInsert(initial, startInserted) = SearchEntry{0, false, MOVE_UP};
+
+    while (!openSet.empty()) {
+        maxStatesEnqueued = std::max(maxStatesEnqueued, static_cast<int>(openSet.size()));
+
+        // Timeout check - prevent infinite execution
+        if (maxTimeSeconds > 0) {
+            auto currentTime = std::chrono::high_resolution_clock::now();
+            double elapsed = std::chrono::duration<double>(currentTime - startTime).count();
+
+            if (elapsed > maxTimeSeconds) {
+                if (!silent) {
+                    std::cout << "\n" << std::string(50, '=') << "\n";
+                    std::cout << "⏱️  TIMEOUT REACHED!\n";
+                    std::cout << std::string(50, '=') << "\n";
+                    std::cout << "Explored " << totalSetOpened << " states before timeout\n";
+                    std::cout << "Maximum states in memory: " << maxStatesEnqueued << "\n";
+                    std::cout << "Time limit: " << maxTimeSeconds << "s\n";
+                    std::cout << "Execution time: " << std::fixed << std::setprecision(4)
+                             << elapsed << "s\n";
+
+                    SolutionLogger::logFailure(
+                        "EPEA*", getHeuristicName(heuristic), initialState, goal, N,
+                        "Timeout reached", totalSetOpened, maxStatesEnqueued, elapsed
+                    );
+                }
+
+                return {false, 0, totalSetOpened, maxStatesEnqueued, elapsed, heuristic, "",
+                        11, "EPEA*", false, "Timeout reached", 1.0, {}, tieBreaking};
+            }
+        }
+
+        // Memory limit check - every node created stays in the arena
+        if (nodes.size() >= maxStates) {
+            auto endTime = std::chrono::high_resolution_clock::now();
+            double duration = std::chrono::duration<double>(endTime - startTime).count();
+
+            if (!silent) {
+                std::cout << "\n" << std::string(50, '=') << "\n";
+                std::cout << "⚠️  MEMORY LIMIT REACHED!\n";
+                std::cout << std::string(50, '=') << "\n";
+                std::cout << "Explored " << totalSetOpened << " states before hitting limit\n";
+                std::cout << "Maximum states in memory: " << maxStatesEnqueued << "\n";
+                std::cout << "Execution time: " << std::fixed << std::setprecision(4)
+                         << duration << "s\n";
+
+                SolutionLogger::logFailure(
+                    "EPEA*", getHeuristicName(heuristic), initialState, goal, N,
+                    "Memory limit reached", totalSetOpened, maxStatesEnqueued, duration
+                );
+            }
+
+            return {false, 0, totalSetOpened, maxStatesEnqueued, duration, heuristic, "",
+                    11, "EPEA*", true, "Memory limit reached", 1.0, {}, tieBreaking};
+        }
+
+        Node<N>* current = openSet.top();
+        openSet.pop();
+        const State<N>& state = current->getState();
+
+        if (state == goalState) {
+            int moves = current->getCost();
+
+            auto endTime = std::chrono::high_resolution_clock::now();
+            double duration = std::chrono::duration<double>(endTime - startTime).count();
+
+            if (!silent) {
+                std::cout << "\n" << std::string(50, '=') << "\n";
+                std::cout << "Solution found!\n";
+                std::cout << std::string(50, '=') << "\n";
+                std::cout << "Total moves required: " << moves << "\n";
+                std::cout << "Total states opened (time complexity): " << totalSetOpened << "\n";
+                std::cout << "Maximum states in memory (space complexity): " << maxStatesEnqueued << "\n";
+                std::cout << "Expansions including re-insertions: " << expansions << "\n";
+                std::cout << "States generated: " << nodes.size() << "\n";
+                std::cout << "Tie-breaking: " << getTieBreakingName(tieBreaking) << "\n";
+                std::cout << "Execution time: " << std::fixed << std::setprecision(4)
+                         << duration << "s\n";
+                std::cout << std::string(50, '=') << "\n";
+
+                SolutionLogger::logSolution(
+                    "EPEA*", getHeuristicName(heuristic), initialState, goal, N,
+                    tracePath(table, initial, state), moves, totalSetOpened, maxStatesEnqueued, duration
+                );
+            }
+
+            return {true, moves, totalSetOpened, maxStatesEnqueued, duration, heuristic, "", 11, "EPEA*", false, "", 1.0, {}, tieBreaking};
+        }
+
+        // Skip nodes closed or superseded by a shorter path; a node between
+        // two partial expansions stays open
+        SearchEntry* currentEntry = table.find(state);
+        if (currentEntry->closed || current->getCost() > currentEntry->g) {
+            continue;
+        }
+        expansions++;
+
+        // Children with f - f(current) equal to stage are generated now, plus
+        // on the first expansion those below it (inconsistent heuristics)
+        int stage = current->getDeltaF();
+        int nextStage = INT_MAX;
+        if (stage == 0) {
+            totalSetOpened++;
+        }
+
+        // Read before the children are inserted: the table may grow and
+        // move currentEntry
+        int backMove = current->getCost() > 0 ? (currentEntry->move ^ 1) : -1;
+        int zeroPos = current->getZeroPos();
+        int gCost = current->getCost() + 1;
+        for (int move = 0; move < MOVE_COUNT; move++) {
+            int newZeroPos = Board<N>::NEIGHBORS[zeroPos][move];
+            if (newZeroPos == Board<N>::NO_CELL) {
+                continue;
+            }
+            // Going straight back never improves the parent's g
+            if (move == backMove) {
+                continue;
+            }
+
+            int deltaF = 0;
+            if (selectByTable) {
+                deltaF = operators[(zeroPos * MOVE_COUNT + move) * Board<N>::CELLS
+                                   + state.get(newZeroPos)];
+                if (deltaF > stage) {
+                    nextStage = std::min(nextStage, deltaF);
+                    continue;
+                }
+                if (deltaF < stage) {
+                    continue;
+                }
+            }
+
+            State<N> childState = state;
+            childState.slide(zeroPos, newZeroPos);
+            HeuristicCache<N> cache;
+            int hCost = estimator.evaluateMove(childState, zeroPos, move,
+                                               current->getHeuristicCache(), cache);
+            if (!selectByTable) {
+                deltaF = 1 + hCost - current->getHeuristic();
+                if (deltaF > stage) {
+                    nextStage = std::min(nextStage, deltaF);
+                    continue;
+                }
+                if (deltaF < stage && stage > 0) {
+                    continue;
+                }
+            }
+
+            // Same skip-or-reopen rule as A*
+            bool inserted;
+            SearchEntry& entry = table.findOrInsert(childState, inserted);
+            if (!inserted && entry.g <= gCost) {
+                continue;
+            }
+            entry.g = gCost;
+            entry.closed = false;
+            entry.move = static_cast<uint8_t>(move);
+
+            openSet.push(nodes.create(childState, static_cast<uint8_t>(newZeroPos), gCost, hCost, cache));
+        }
+
+        // Back in the open list at the next f a child has, or done
+        if (nextStage != INT_MAX) {
+            current->setDeltaF(nextStage);
+            openSet.push(current);
+        } else {
+            table.find(state)->closed = true;
+        }
+    }
+
+    // No solution found
+    auto endTime = std::chrono::high_resolution_clock::now();
+    double duration = std::chrono::duration<double>(endTime - startTime).count();
+
+    if (!silent) {
+        std::cout << "\n" << std::string(50, '=') << "\n";
+        std::cout << "No solution found! Puzzle may be unsolvable.\n";
+        std::cout << std::string(50, '=') << "\n";
+        std::cout << "Total states opened: " << totalSetOpened << "\n";
+        std::cout << "Maximum states in memory: " << maxStatesEnqueued << "\n";
+        std::cout << "Execution time: " << std::fixed << std::setprecision(4)
+                 << duration << "s\n";
+        std::cout << std::string(50, '=') << "\n";
+
+        SolutionLogger::logFailure(
+            "EPEA*", getHeuristicName(heuristic), initialState, goal, N,
+            "No solution found", totalSetOpened, maxStatesEnqueued, duration
+        );
+    }
+
+    return {false, 0, totalSetOpened, maxStatesEnqueued, duration, heuristic, "",
+            11, "EPEA*", false, "No solution found", 1.0, {}, tieBreaking};
+}
+
+#define INSTANTIATE_EPEASTAR(N) \
+    template AStarResult EPEAstar::solve<N>(Puzzle&, int, bool, size_t, double, TieBreaking);
+NPUZZLE_FOR_EACH_SIZE(INSTANTIATE_EPEASTAR)
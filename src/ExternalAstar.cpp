@@ -0,0 +1,457 @@
+#include "../includes/ExternalAstar.hpp"
+#include "../includes/SolutionLogger.hpp"
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <algorithm>
+#include <atomic>
+#include <climits>
+#include <cstdio>
+#include <memory>
+#include <queue>
+#include <unistd.h>
+#include <sys/stat.h>
+
+ExternalAstar::ExternalAstar() {}
+
+ExternalAstar::~ExternalAstar() {}
+
+ExternalAstar::ExternalAstar(const ExternalAstar& other) {
+    (void)other;
+}
+
+ExternalAstar& ExternalAstar::operator=(const ExternalAstar& other) {
+    (void)other;
+    return *this;
+}
+
+template <int N>
+ExternalAstar::RecordReader<N>::RecordReader(const std::string& path, size_t bufferRecords)
+    : file(path, std::ios::binary), buffer(), position(0) {
+    buffer.reserve(bufferRecords);
+}
+
+template <int N>
+bool ExternalAstar::RecordReader<N>::next(Record<N>& record) {
+    if (position == buffer.size()) {
+        // Refill with as many whole records as the file still has
+        buffer.resize(buffer.capacity());
+        file.read(reinterpret_cast<char*>(buffer.data()),
+                  static_cast<std::streamsize>(buffer.size() * sizeof(Record<N>)));
+        buffer.resize(static_cast<size_t>(file.gcount()) / sizeof(Record<N>));
+        position = 0;
+        if (buffer.empty()) {
+            return false;
+        }
+    }
+    record = buffer[position++];
+    return true;
+}
+
+std::string ExternalAstar::filePath(const std::string& directory, const char* kind, size_t index) {
+    return directory + "/" + kind + "-" + std::to_string(index) + ".bin";
+}
+
+std::string ExternalAstar::makeScratchDirectory(const std::string& directory) {
+    // One counter for every board size: searches of one process (a batch)
+    // running at the same time each get their own directory
+    static std::atomic<unsigned int> searchCount(0);
+
+    struct stat st;
+    if (stat(directory.c_str(), &st) != 0) {
+        mkdir(directory.c_str(), 0755);
+    }
+    std::string scratch = directory + "/search-" + std::to_string(getpid()) + "-"
+                          + std::to_string(searchCount++);
+    mkdir(scratch.c_str(), 0755);
+    return scratch;
+}
+
+size_t ExternalAstar::fileSize(const std::string& path) {
+    struct stat st;
+    return stat(path.c_str(), &st) == 0 ? static_cast<size_t>(st.st_size) : 0;
+}
+
+template <int N>
+bool ExternalAstar::writeRun(const std::string& path, std::vector<Record<N>>& records) {
+    std::sort(records.begin(), records.end(),
+              [](const Record<N>& a, const Record<N>& b) { return a.state < b.state; });
+    records.erase(std::unique(records.begin(), records.end(),
+                              [](const Record<N>& a, const Record<N>& b) { return a.state == b.state; }),
+                  records.end());
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file.write(reinterpret_cast<const char*>(records.data()),
+               static_cast<std::streamsize>(records.size() * sizeof(Record<N>)));
+    file.close();
+    return static_cast<bool>(file);
+}
+
+template <int N>
+size_t ExternalAstar::merge(const std::vector<std::string>& inputs, const std::string& exclude,
+                            const std::string& output, bool& ok) {
+    std::vector<std::unique_ptr<RecordReader<N>>> readers;
+    std::vector<Record<N>> heads(inputs.size());
+    auto later = [&heads](size_t a, size_t b) { return heads[b].state < heads[a].state; };
+    std::priority_queue<size_t, std::vector<size_t>, decltype(later)> queue(later);
+    for (size_t i = 0; i < inputs.size(); i++) {
+        readers.emplace_back(new RecordReader<N>(inputs[i], READ_BUFFER_RECORDS));
+        if (readers[i]->next(heads[i])) {
+            queue.push(i);
+        }
+    }
+
+    // The excluded layer is sorted too: walked alongside, never searched
+    std::unique_ptr<RecordReader<N>> excluded;
+    Record<N> seen;
+    bool hasSeen = false;
+    if (!exclude.empty()) {
+        excluded.reset(new RecordReader<N>(exclude, READ_BUFFER_RECORDS));
+        hasSeen = excluded->next(seen);
+    }
+
+    std::ofstream file(output, std::ios::binary | std::ios::trunc);
+    std::vector<Record<N>> pending;
+    pending.reserve(READ_BUFFER_RECORDS);
+    size_t written = 0;
+    bool hasLast = false;
+    State<N> last;
+
+    while (!queue.empty()) {
+        size_t input = queue.top();
+        queue.pop();
+        Record<N> record = heads[input];
+        if (readers[input]->next(heads[input])) {
+            queue.push(input);
+        }
+
+        // Runs are sorted and unique, so repeats arrive back to back
+        if (hasLast && record.state == last) {
+            continue;
+        }
+        last = record.state;
+        hasLast = true;
+        while (hasSeen && seen.state < record.state) {
+            hasSeen = excluded->next(seen);
+        }
+        if (hasSeen && seen.state == record.state) {
+            continue;
+        }
+
+        pending.push_back(record);
+        written++;
+        if (pending.size() == READ_BUFFER_RECORDS) {
+            file.write(reinterpret_cast<const char*>(pending.data()),
+                       static_cast<std::streamsize>(pending.size() * sizeof(Record<N>)));
+            pending.clear();
+        }
+    }
+    file.write(reinterpret_cast<const char*>(pending.data()),
+               static_cast<std::streamsize>(pending.size() * sizeof(Record<N>)));
+    file.close();
+    ok = static_cast<bool>(file);
+    return written;
+}
+
+template <int N>
+bool ExternalAstar::findRecord(const std::string& path, const State<N>& state, Record<N>& record) {
+    std::ifstream file(path, std::ios::binary);
+    size_t low = 0;
+    size_t high = fileSize(path) / sizeof(Record<N>);
+    while (low < high) {
+        size_t middle = low + (high - low) / 2;
+        file.seekg(static_cast<std::streamoff>(middle * sizeof(Record<N>)));
+        if (!file.read(reinterpret_cast<char*>(&record), sizeof(Record<N>))) {
+            return false;
+        }
+        if (record.state == state) {
+            return true;
+        }
+        if (record.state < state) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    return false;
+}
+
+template <int N>
+AStarResult ExternalAstar::solve(Puzzle& puzzle, int heuristic, bool silent, double maxTimeSeconds,
+                                 size_t memoryBudgetMB, const std::string& directory) {
+    auto startTime = std::chrono::high_resolution_clock::now();
+    memoryBudgetMB = std::max(memoryBudgetMB, MIN_MEMORY_MB);
+
+    // Get initial state and goal
+    const std::vector<uint8_t>& initialState = puzzle.getGrid();
+    const std::vector<uint8_t>& goal = puzzle.getGoal();
+
+    // Packed search representation of the start and goal boards
+    const State<N> initial(initialState);
+    const State<N> goalState(goal);
+
+    // The child buffer gets the budget left once every merge input has its buffer
+    size_t budget = memoryBudgetMB << 20;
+    size_t readerBytes = (MERGE_FAN_IN + 2) * READ_BUFFER_RECORDS * sizeof(Record<N>);
+    size_t bufferRecords = std::max<size_t>(READ_BUFFER_RECORDS,
+                                            (budget - std::min(budget, readerBytes)) / sizeof(Record<N>));
+
+    // Display memory and time limits (set by Game class)
+    if (!silent) {
+        std::cout << "\n[Memory Safety] RAM budget " << memoryBudgetMB << " MB ("
+                  << bufferRecords << " states per sorted run), layers spilled to "
+                  << directory << "/\n";
+        std::cout << "[Time Safety] Max execution time: " << maxTimeSeconds << " seconds\n";
+    }
+
+    // Check if already at goal
+    if (initial == goalState) {
+        if (!silent) {
+            std::cout << "\nPuzzle is already solved!\n";
+        }
+        auto endTime = std::chrono::high_resolution_clock::now();
+        double duration = std::chrono::duration<double>(endTime - startTime).count();
+
+        return {true, 0, 0, 0, duration, heuristic, "", 13, "External A*", false, "", 1.0};
+    }
+
+    // Check if puzzle is solvable
+    if (!puzzle.isSolvable()) {
+        if (!silent) {
+            std::cout << "\nPuzzle is unsolvable!\n";
+
+            // Log failure to file
+            std::string heuristicName = getHeuristicName(heuristic);
+
+            SolutionLogger::logFailure(
+                "External A*", heuristicName, initialState, goal, N,
+                "Puzzle is unsolvable", 0, 0, 0
+            );
+        }
+        auto endTime = std::chrono::high_resolution_clock::now();
+        double duration = std::chrono::duration<double>(endTime - startTime).count();
+
+        return {false, 0, 0, 0, duration, heuristic, "", 13, "External A*", false, "Puzzle is unsolvable", 1.0};
+    }
+
+    // Scratch directory of this run, so concurrent solvers never share files
+    std::string scratch = makeScratchDirectory(directory);
+
+    // Goal lookup and per-move delta tables, built once per goal and heuristic
+    const Heuristic<N>& estimator = Heuristic<N>::get(goal, heuristic);
+    HeuristicCache<N> initialCache;
+    int bound = estimator.evaluate(initial, initialCache);
+
+    long long expanded = 0;
+    size_t largestLayer = 1;
+    size_t peakDisk = 0;
+    int iterations = 0;
+    bool found = false;
+    bool timedOut = false;
+    bool ioFailed = false;
+    std::vector<uint8_t> path;
+    std::vector<Record<N>> children;
+    size_t runCount = 0;
+
+    while (!found && !timedOut && !ioFailed && bound != INT_MAX) {
+        iterations++;
+        int nextBound = INT_MAX;
+        int depth = 0;
+        size_t layerBytes = sizeof(Record<N>);
+        std::vector<Record<N>> start = {{initial, NO_MOVE}};
+        ioFailed = !writeRun(filePath(scratch, "layer", 0), start);
+
+        // Goal reached from parent (in layer goalDepth - 1) by goalMove
+        Record<N> parent = start[0];
+        uint8_t goalMove = 0;
+
+        while (!found && !timedOut && !ioFailed) {
+            RecordReader<N> reader(filePath(scratch, "layer", depth), READ_BUFFER_RECORDS);
+            std::vector<std::string> runs;
+            children.clear();
+            children.reserve(bufferRecords);
+
+            Record<N> record;
+            while (!found && reader.next(record)) {
+                expanded++;
+                if (maxTimeSeconds > 0 && expanded % TIME_CHECK_INTERVAL == 0) {
+                    double elapsed = std::chrono::duration<double>(
+                        std::chrono::high_resolution_clock::now() - startTime).count();
+                    if (elapsed > maxTimeSeconds) {
+                        timedOut = true;
+                        break;
+                    }
+                }
+
+                int zeroPos = 0;
+                while (record.state.get(zeroPos) != 0) {
+                    zeroPos++;
+                }
+                // The cache is not stored on disk: one full evaluation per
+                // parent, then incremental ones for its children
+                HeuristicCache<N> cache;
+                estimator.evaluate(record.state, cache);
+
+                for (int move = 0; move < MOVE_COUNT; move++) {
+                    int newZeroPos = Board<N>::NEIGHBORS[zeroPos][move];
+                    if (newZeroPos == Board<N>::NO_CELL
+                        || (record.move != NO_MOVE && move == (record.move ^ 1))) {
+                        continue;
+                    }
+                    State<N> child = record.state;
+                    child.slide(zeroPos, newZeroPos);
+                    if (child == goalState) {
+                        found = true;
+                        parent = record;
+                        goalMove = static_cast<uint8_t>(move);
+                        break;
+                    }
+
+                    HeuristicCache<N> childCache;
+                    int f = depth + 1 + estimator.evaluateMove(child, zeroPos, move, cache, childCache);
+                    if (f > bound) {
+                        nextBound = std::min(nextBound, f);
+                        continue;
+                    }
+                    children.push_back({child, static_cast<uint8_t>(move)});
+                    if (children.size() == bufferRecords) {
+                        runs.push_back(filePath(scratch, "run", runCount++));
+                        ioFailed = ioFailed || !writeRun(runs.back(), children);
+                        layerBytes += fileSize(runs.back());
+                        children.clear();
+                    }
+                }
+            }
+            if (found || timedOut || ioFailed) {
+                for (const std::string& run : runs) {
+                    std::remove(run.c_str());
+                }
+                break;
+            }
+            if (!children.empty()) {
+                runs.push_back(filePath(scratch, "run", runCount++));
+                ioFailed = !writeRun(runs.back(), children);
+                layerBytes += fileSize(runs.back());
+            }
+            peakDisk = std::max(peakDisk, layerBytes);
+
+            // Too many runs for one merge: merge them by groups first
+            while (runs.size() > MERGE_FAN_IN && !ioFailed) {
+                std::vector<std::string> merged;
+                for (size_t first = 0; first < runs.size(); first += MERGE_FAN_IN) {
+                    std::vector<std::string> group(runs.begin() + first,
+                        runs.begin() + std::min(runs.size(), first + MERGE_FAN_IN));
+                    merged.push_back(filePath(scratch, "run", runCount++));
+                    bool ok;
+                    merge<N>(group, "", merged.back(), ok);
+                    ioFailed = ioFailed || !ok;
+                    for (const std::string& run : group) {
+                        std::remove(run.c_str());
+                    }
+                }
+                runs = merged;
+            }
+
+            std::string previous = depth > 0 ? filePath(scratch, "layer", depth - 1) : "";
+            bool ok;
+            size_t layerSize = merge<N>(runs, previous, filePath(scratch, "layer", depth + 1), ok);
+            ioFailed = ioFailed || !ok;
+            for (const std::string& run : runs) {
+                std::remove(run.c_str());
+            }
+            depth++;
+            layerBytes += layerSize * sizeof(Record<N>);
+            largestLayer = std::max(largestLayer, layerSize);
+            if (layerSize == 0) {
+                break;
+            }
+        }
+
+        if (found) {
+            // Undo the recorded moves layer by layer back to the start
+            path.push_back(goalMove);
+            Record<N> record = parent;
+            for (int layer = depth; layer > 0; layer--) {
+                path.push_back(record.move);
+                int zeroPos = 0;
+                while (record.state.get(zeroPos) != 0) {
+                    zeroPos++;
+                }
+                State<N> previous = record.state;
+                previous.slide(zeroPos, Board<N>::NEIGHBORS[zeroPos][record.move ^ 1]);
+                if (!findRecord(filePath(scratch, "layer", layer - 1), previous, record)) {
+                    ioFailed = true;
+                    break;
+                }
+            }
+            std::reverse(path.begin(), path.end());
+        }
+
+        for (int layer = 0; layer <= depth + 1; layer++) {
+            std::remove(filePath(scratch, "layer", layer).c_str());
+        }
+        bound = nextBound;
+    }
+    rmdir(scratch.c_str());
+
+    auto endTime = std::chrono::high_resolution_clock::now();
+    double duration = std::chrono::duration<double>(endTime - startTime).count();
+    int totalSetOpened = static_cast<int>(std::min<long long>(expanded, INT_MAX));
+    int maxStatesEnqueued = static_cast<int>(std::min<size_t>(largestLayer, INT_MAX));
+
+    if (found && !ioFailed) {
+        int moves = static_cast<int>(path.size());
+
+        if (!silent) {
+            std::cout << "\n" << std::string(50, '=') << "\n";
+            std::cout << "Solution found!\n";
+            std::cout << std::string(50, '=') << "\n";
+            std::cout << "Total moves required: " << moves << "\n";
+            std::cout << "Total states opened (time complexity): " << totalSetOpened << "\n";
+            std::cout << "Maximum states in memory (space complexity): " << maxStatesEnqueued
+                      << " (largest layer, on disk)\n";
+            std::cout << "Iterations (f bounds searched): " << iterations << "\n";
+            std::cout << "Peak disk usage: " << (peakDisk >> 20) << " MB\n";
+            std::cout << "Execution time: " << std::fixed << std::setprecision(4)
+                     << duration << "s\n";
+            std::cout << std::string(50, '=') << "\n";
+
+            SolutionLogger::logSolution(
+                "External A*", getHeuristicName(heuristic), initialState, goal, N,
+                path, moves, totalSetOpened, maxStatesEnqueued, duration
+            );
+        }
+
+        return {true, moves, totalSetOpened, maxStatesEnqueued, duration, heuristic, "", 13, "External A*", false, "", 1.0};
+    }
+
+    std::string reason = timedOut ? "Timeout reached"
+                       : ioFailed ? "Disk write failed" : "No solution found";
+    if (!silent) {
+        std::cout << "\n" << std::string(50, '=') << "\n";
+        if (timedOut) {
+            std::cout << "⏱️  TIMEOUT REACHED!\n";
+        } else if (ioFailed) {
+            std::cout << "⚠️  DISK WRITE FAILED (" << directory << "/ full or not writable)\n";
+        } else {
+            std::cout << "No solution found! Puzzle may be unsolvable.\n";
+        }
+        std::cout << std::string(50, '=') << "\n";
+        std::cout << "Explored " << totalSetOpened << " states (last f bound: " << bound << ")\n";
+        std::cout << "Largest layer: " << maxStatesEnqueued << "\n";
+        std::cout << "Execution time: " << std::fixed << std::setprecision(4)
+                 << duration << "s\n";
+
+        SolutionLogger::logFailure(
+            "External A*", getHeuristicName(heuristic), initialState, goal, N,
+            reason, totalSetOpened, maxStatesEnqueued, duration
+        );
+    }
+
+    return {false, 0, totalSetOpened, maxStatesEnqueued, duration, heuristic, "",
+            13, "External A*", false, reason, 1.0};
+}
+
+#define INSTANTIATE_EXTERNALASTAR(N) \
+    template AStarResult ExternalAstar::solve<N>(Puzzle&, int, bool, double, size_t, const std::string&);
+NPUZZLE_FOR_EACH_SIZE(INSTANTIATE_EXTERNALASTAR)
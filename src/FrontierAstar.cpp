@@ -0,0 +1,316 @@
+#include "../includes/FrontierAstar.hpp"
+#include "../includes/SolutionLogger.hpp"
+#include "../includes/StateTable.hpp"
+#include "../includes/NodeArena.hpp"
+#include "../includes/PatternDatabase.hpp"
+#include <iostream>
+#include <iomanip>
+#include <algorithm>
+
+FrontierAstar::FrontierAstar() {}
+
+FrontierAstar::~FrontierAstar() {}
+
+FrontierAstar::FrontierAstar(const FrontierAstar& other) {
+    (void)other;
+}
+
+FrontierAstar& FrontierAstar::operator=(const FrontierAstar& other) {
+    (void)other;
+    return *this;
+}
+
+template <int N>
+FrontierAstar::Outcome<N> FrontierAstar::search(const State<N>& start, const State<N>& target,
+                                                const Heuristic<N>& estimator, size_t maxStates,
+                                                std::chrono::high_resolution_clock::time_point startTime,
+                                                double maxTimeSeconds, TieBreaking tieBreaking) {
+    Outcome<N> outcome = {false, false, false, 0, start, 0, 0, 0};
+
+    int startZeroPos = 0;
+    while (start.get(startZeroPos) != 0) {
+        startZeroPos++;
+    }
+    HeuristicCache<N> startCache;
+    int startH = estimator.evaluate(start, startCache);
+
+    // Slots of expanded and superseded nodes are reused by the next children
+    NodeArena<Node<N>> nodes;
+    BucketQueue<Node<N>*> openSet(tieBreaking);
+    openSet.push(nodes.create(start, static_cast<uint8_t>(startZeroPos), 0, startH, startCache));
+
+    // Open states only: an expanded state is erased from the table
+    StateTable<N, FrontierEntry<N>> table(maxStates);
+    bool startInserted;
+    FrontierEntry<N>& startEntry = table.findOrInsert(start, startInserted);
+    startEntry.g = 0;
+    startEntry.relay = start;
+
+    while (!openSet.empty()) {
+        outcome.maxOpen = std::max(outcome.maxOpen, static_cast<int>(openSet.size()));
+        outcome.maxStored = std::max(outcome.maxStored, table.size());
+
+        if (maxTimeSeconds > 0) {
+            double elapsed = std::chrono::duration<double>(
+                std::chrono::high_resolution_clock::now() - startTime).count();
+            if (elapsed > maxTimeSeconds) {
+                outcome.timedOut = true;
+                return outcome;
+            }
+        }
+
+        // Nodes alive at once, the open list included
+        if (nodes.size() >= maxStates) {
+            outcome.memoryLimitReached = true;
+            return outcome;
+        }
+
+        Node<N>* current = openSet.top();
+        openSet.pop();
+        const State<N> state = current->getState();
+
+        // Expanded already, or superseded by a shorter path
+        FrontierEntry<N>* entry = table.find(state);
+        if (!entry || current->getCost() > entry->g) {
+            nodes.release(current);
+            continue;
+        }
+
+        if (state == target) {
+            outcome.found = true;
+            outcome.cost = current->getCost();
+            outcome.relay = entry->relay;
+            return outcome;
+        }
+
+        // Forget the state; its neighbors keep a used bit pointing back to it
+        uint8_t used = entry->used;
+        State<N> relay = entry->relay;
+        table.erase(state);
+        outcome.expanded++;
+
+        int zeroPos = current->getZeroPos();
+        int gCost = current->getCost() + 1;
+        for (int move = 0; move < MOVE_COUNT; move++) {
+            int newZeroPos = Board<N>::NEIGHBORS[zeroPos][move];
+            if (newZeroPos == Board<N>::NO_CELL || (used & (1 << move))) {
+                continue;
+            }
+
+            State<N> childState = state;
+            childState.slide(zeroPos, newZeroPos);
+
+            bool inserted;
+            FrontierEntry<N>& childEntry = table.findOrInsert(childState, inserted);
+            childEntry.used |= static_cast<uint8_t>(1 << (move ^ 1));
+            if (!inserted && childEntry.g <= gCost) {
+                continue;
+            }
+
+            HeuristicCache<N> cache;
+            int hCost = estimator.evaluateMove(childState, zeroPos, move,
+                                               current->getHeuristicCache(), cache);
+            childEntry.g = gCost;
+            childEntry.relay = gCost <= hCost ? childState : relay;
+
+            openSet.push(nodes.create(childState, static_cast<uint8_t>(newZeroPos), gCost, hCost, cache));
+        }
+        nodes.release(current);
+    }
+    return outcome;
+}
+
+template <int N>
+void FrontierAstar::recoverPath(const State<N>& from, const State<N>& to, int cost,
+                                const State<N>& relay, const State<N>& goal, int heuristic,
+                                size_t maxStates, TieBreaking tieBreaking,
+                                std::vector<uint8_t>& path) {
+    if (cost == 0) {
+        return;
+    }
+
+    int zeroPos = 0;
+    while (from.get(zeroPos) != 0) {
+        zeroPos++;
+    }
+
+    if (cost == 1) {
+        for (int move = 0; move < MOVE_COUNT; move++) {
+            int newZeroPos = Board<N>::NEIGHBORS[zeroPos][move];
+            if (newZeroPos == Board<N>::NO_CELL) {
+                continue;
+            }
+            State<N> next = from;
+            next.slide(zeroPos, newZeroPos);
+            if (next == to) {
+                path.push_back(static_cast<uint8_t>(move));
+                return;
+            }
+        }
+        return;
+    }
+
+    // Pattern databases only exist toward the goal; other targets use Linear Conflict
+    int towardGoal = heuristic;
+    int towardOther = PatternDatabase::isPatternHeuristic(heuristic) ? 3 : heuristic;
+    const Heuristic<N> toTarget(to.toVector(), to == goal ? towardGoal : towardOther);
+    auto now = std::chrono::high_resolution_clock::now();
+
+    if (relay == from || relay == to) {
+        // No state with g <= h inside the path: peel off the first move instead
+        for (int move = 0; move < MOVE_COUNT; move++) {
+            int newZeroPos = Board<N>::NEIGHBORS[zeroPos][move];
+            if (newZeroPos == Board<N>::NO_CELL) {
+                continue;
+            }
+            State<N> next = from;
+            next.slide(zeroPos, newZeroPos);
+            Outcome<N> rest = search(next, to, toTarget, maxStates, now, 0, tieBreaking);
+            if (rest.found && rest.cost == cost - 1) {
+                path.push_back(static_cast<uint8_t>(move));
+                recoverPath(next, to, rest.cost, rest.relay, goal, heuristic, maxStates,
+                            tieBreaking, path);
+                return;
+            }
+        }
+        return;
+    }
+
+    // The relay lies on an optimal path, so both halves are optimal paths too
+    const Heuristic<N> toRelay(relay.toVector(), towardOther);
+    Outcome<N> first = search(from, relay, toRelay, maxStates, now, 0, tieBreaking);
+    Outcome<N> second = search(relay, to, toTarget, maxStates, now, 0, tieBreaking);
+    if (!first.found || !second.found) {
+        return;
+    }
+    recoverPath(from, relay, first.cost, first.relay, goal, heuristic, maxStates, tieBreaking, path);
+    recoverPath(relay, to, second.cost, second.relay, goal, heuristic, maxStates, tieBreaking, path);
+}
+
+template <int N>
+AStarResult FrontierAstar::solve(Puzzle& puzzle, int heuristic, bool silent, size_t maxStates,
+                                 double maxTimeSeconds, TieBreaking tieBreaking) {
+    auto startTime = std::chrono::high_resolution_clock::now();
+
+    // Get initial state and goal
+    const std::vector<uint8_t>& initialState = puzzle.getGrid();
+    const std::vector<uint8_t>& goal = puzzle.getGoal();
+
+    // Packed search representation of the start and goal boards
+    const State<N> initial(initialState);
+    const State<N> goalState(goal);
+
+    // Display memory and time limits (set by Game class)
+    if (!silent) {
+        // Node, open-list pointer and table slot per state held, none per state expanded
+        size_t bytesPerState = sizeof(Node<N>) + sizeof(Node<N>*)
+                               + StateTable<N, FrontierEntry<N>>::bytesPerEntry();
+        size_t estimatedMB = maxStates * bytesPerState / (1024 * 1024);
+        std::cout << "\n[Memory Safety] Max states held limited to " << maxStates
+                 << " (~" << estimatedMB << " MB)\n";
+        std::cout << "[Time Safety] Max execution time: " << maxTimeSeconds << " seconds\n";
+    }
+
+    // Check if already at goal
+    if (initial == goalState) {
+        if (!silent) {
+            std::cout << "\nPuzzle is already solved!\n";
+        }
+        auto endTime = std::chrono::high_resolution_clock::now();
+        double duration = std::chrono::duration<double>(endTime - startTime).count();
+
+        return {true, 0, 0, 0, duration, heuristic, "", 12, "Frontier A*", false, "", 1.0, {}, tieBreaking};
+    }
+
+    // Check if puzzle is solvable
+    if (!puzzle.isSolvable()) {
+        if (!silent) {
+            std::cout << "\nPuzzle is unsolvable!\n";
+
+            // Log failure to file
+            std::string heuristicName = getHeuristicName(heuristic);
+
+            SolutionLogger::logFailure(
+                "Frontier A*", heuristicName, initialState, goal, N,
+                "Puzzle is unsolvable", 0, 0, 0
+            );
+        }
+        auto endTime = std::chrono::high_resolution_clock::now();
+        double duration = std::chrono::duration<double>(endTime - startTime).count();
+
+        return {false, 0, 0, 0, duration, heuristic, "", 12, "Frontier A*", false, "Puzzle is unsolvable", 1.0, {}, tieBreaking};
+    }
+
+    // Goal lookup and per-move delta tables, built once per goal and heuristic
+    const Heuristic<N>& estimator = Heuristic<N>::get(goal, heuristic);
+
+    Outcome<N> outcome = search(initial, goalState, estimator, maxStates, startTime,
+                                maxTimeSeconds, tieBreaking);
+    int totalSetOpened = outcome.expanded;
+    int maxStatesEnqueued = outcome.maxOpen;
+
+    auto endTime = std::chrono::high_resolution_clock::now();
+    double duration = std::chrono::duration<double>(endTime - startTime).count();
+
+    if (outcome.found) {
+        int moves = outcome.cost;
+
+        if (!silent) {
+            // Only now is the path needed: rebuild it through the relays
+            std::vector<uint8_t> path;
+            recoverPath(initial, goalState, moves, outcome.relay, goalState, heuristic, maxStates,
+                        tieBreaking, path);
+            double recovery = std::chrono::duration<double>(
+                std::chrono::high_resolution_clock::now() - endTime).count();
+
+            std::cout << "\n" << std::string(50, '=') << "\n";
+            std::cout << "Solution found!\n";
+            std::cout << std::string(50, '=') << "\n";
+            std::cout << "Total moves required: " << moves << "\n";
+            std::cout << "Total states opened (time complexity): " << totalSetOpened << "\n";
+            std::cout << "Maximum states in memory (space complexity): " << maxStatesEnqueued << "\n";
+            std::cout << "Most states held at once (frontier only): " << outcome.maxStored << "\n";
+            std::cout << "Tie-breaking: " << getTieBreakingName(tieBreaking) << "\n";
+            std::cout << "Execution time: " << std::fixed << std::setprecision(4)
+                     << duration << "s (path recovery: " << recovery << "s more)\n";
+            std::cout << std::string(50, '=') << "\n";
+
+            SolutionLogger::logSolution(
+                "Frontier A*", getHeuristicName(heuristic), initialState, goal, N,
+                path, moves, totalSetOpened, maxStatesEnqueued, duration
+            );
+        }
+
+        return {true, moves, totalSetOpened, maxStatesEnqueued, duration, heuristic, "", 12, "Frontier A*", false, "", 1.0, {}, tieBreaking};
+    }
+
+    std::string reason = outcome.timedOut ? "Timeout reached"
+                       : outcome.memoryLimitReached ? "Memory limit reached" : "No solution found";
+    if (!silent) {
+        std::cout << "\n" << std::string(50, '=') << "\n";
+        if (outcome.timedOut) {
+            std::cout << "⏱️  TIMEOUT REACHED!\n";
+        } else if (outcome.memoryLimitReached) {
+            std::cout << "⚠️  MEMORY LIMIT REACHED!\n";
+        } else {
+            std::cout << "No solution found! Puzzle may be unsolvable.\n";
+        }
+        std::cout << std::string(50, '=') << "\n";
+        std::cout << "Explored " << totalSetOpened << " states\n";
+        std::cout << "Maximum states in memory: " << maxStatesEnqueued << "\n";
+        std::cout << "Execution time: " << std::fixed << std::setprecision(4)
+                 << duration << "s\n";
+
+        SolutionLogger::logFailure(
+            "Frontier A*", getHeuristicName(heuristic), initialState, goal, N,
+            reason, totalSetOpened, maxStatesEnqueued, duration
+        );
+    }
+
+    return {false, 0, totalSetOpened, maxStatesEnqueued, duration, heuristic, "",
+            12, "Frontier A*", outcome.memoryLimitReached, reason, 1.0, {}, tieBreaking};
+}
+
+#define INSTANTIATE_FRONTIERASTAR(N) \
+    template AStarResult FrontierAstar::solve<N>(Puzzle&, int, bool, size_t, double, TieBreaking);
+NPUZZLE_FOR_EACH_SIZE(INSTANTIATE_FRONTIERASTAR)
@@ -1,5 +1,6 @@
 #include "../includes/Game.hpp"
 #include "../includes/Puzzle.hpp"
+#include "../includes/PatternDatabase.hpp"
 #include <map>
 #include <string>
 
@@ -9,7 +10,11 @@ Game::~Game() {}
 
 Game::Game(const Game& other) : _display(other._display), _astar(other._astar), 
                                  _ucs(other._ucs), _weightedAstar(other._weightedAstar), 
-                                 _greedy(other._greedy), _beamSearch(other._beamSearch) {}
+                                 _greedy(other._greedy), _beamSearch(other._beamSearch),
+                                 _idaStar(other._idaStar), _bidirectional(other._bidirectional),
+                                 _hdaStar(other._hdaStar), _epeaStar(other._epeaStar),
+                                 _frontierAstar(other._frontierAstar),
+                                 _externalAstar(other._externalAstar) {}
 
 Game& Game::operator=(const Game& other) {
     if (this != &other) {
@@ -19,10 +24,68 @@ Game& Game::operator=(const Game& other) {
         _weightedAstar = other._weightedAstar;
         _greedy = other._greedy;
         _beamSearch = other._beamSearch;
+        _idaStar = other._idaStar;
+        _bidirectional = other._bidirectional;
+        _hdaStar = other._hdaStar;
+        _epeaStar = other._epeaStar;
+        _frontierAstar = other._frontierAstar;
+        _externalAstar = other._externalAstar;
     }
     return *this;
 }
 
+template <int N>
+void Game::runSolver(Puzzle& puzzle, int algorithm, int heuristic, double weight, int beamWidth,
+                     int threads, TieBreaking tieBreaking, size_t memoryBudgetMB) {
+    // Route to appropriate algorithm based on user's choice
+    // All algorithms use the same time and memory limits defined in Game class
+    if (algorithm == 1) {
+        // A* - pass heuristic (1=Manhattan, 2=Hamming, 3=Linear Conflict, 5/6=pattern databases)
+        _astar.solve<N>(puzzle, heuristic, false, DEFAULT_MAX_STATES, DEFAULT_MAX_TIME, tieBreaking);
+    } else if (algorithm == 2) {
+        // UCS - no heuristic needed (uses only g(n))
+        _ucs.solve<N>(puzzle, false, DEFAULT_MAX_STATES, DEFAULT_MAX_TIME, tieBreaking);
+    } else if (algorithm == 3) {
+        // Greedy Search - pass heuristic (1=Manhattan, 2=Hamming, 3=Linear Conflict, 5/6=pattern databases)
+        _greedy.solve<N>(puzzle, heuristic, false, DEFAULT_MAX_STATES, DEFAULT_MAX_TIME, tieBreaking);
+    } else if (algorithm == 4) {
+        // Weighted A* - pass heuristic (1=Manhattan, 2=Hamming, 3=Linear Conflict, 5/6=pattern databases) and weight
+        _weightedAstar.solve<N>(puzzle, heuristic, false, DEFAULT_MAX_STATES, DEFAULT_MAX_TIME, weight,
+                                tieBreaking);
+    } else if (algorithm == 5) {
+        // Beam Search - pass heuristic (1=Manhattan, 2=Hamming, 3=Linear Conflict, 5/6=pattern databases) and beam width
+        _beamSearch.solve<N>(puzzle, heuristic, false, DEFAULT_MAX_STATES, DEFAULT_MAX_TIME, beamWidth,
+                             threads, tieBreaking);
+    } else if (algorithm == 6) {
+        // IDA* - same heuristics as A*, no state limit (memory grows with solution depth only)
+        _idaStar.solve<N>(puzzle, heuristic, false, DEFAULT_MAX_TIME, threads);
+    } else if (algorithm == 7) {
+        // Bidirectional MM - same heuristics as A*, toward the goal and toward the start
+        _bidirectional.solve<N>(puzzle, heuristic, false, DEFAULT_MAX_STATES, DEFAULT_MAX_TIME);
+    } else if (algorithm == 8) {
+        // HDA* - same heuristics and limits as A*, spread over worker threads
+        _hdaStar.solve<N>(puzzle, heuristic, false, DEFAULT_MAX_STATES, DEFAULT_MAX_TIME, threads,
+                          tieBreaking);
+    } else if (algorithm == 9) {
+        // EPEA* - same heuristics and limits as A*, children generated by f stage
+        _epeaStar.solve<N>(puzzle, heuristic, false, DEFAULT_MAX_STATES, DEFAULT_MAX_TIME, tieBreaking);
+    } else if (algorithm == 10) {
+        // Frontier A* - same heuristics as A*, the state limit counts the frontier only
+        _frontierAstar.solve<N>(puzzle, heuristic, false, DEFAULT_MAX_STATES, DEFAULT_MAX_TIME,
+                                tieBreaking);
+    } else if (algorithm == 11) {
+        // External A* - same heuristics as A*, bounded by a RAM budget instead of a state limit
+        _externalAstar.solve<N>(puzzle, heuristic, false, DEFAULT_MAX_TIME, memoryBudgetMB);
+    } else if (algorithm == 12) {
+        // ARA* - Weighted A* passes from the given weight down to 1, best solution kept at the time limit
+        _weightedAstar.solveAnytime<N>(puzzle, heuristic, false, DEFAULT_MAX_STATES, DEFAULT_MAX_TIME, weight,
+                                       WeightedAstar::DEFAULT_WEIGHT_STEP, tieBreaking);
+    } else if (algorithm == 13) {
+        // Beam-stack Search - beam width is only the first one tried
+        _beamSearch.solveBeamStack<N>(puzzle, heuristic, false, DEFAULT_MAX_STATES, DEFAULT_MAX_TIME, beamWidth);
+    }
+}
+
 void Game::gameLoop() {
     // Get grid size from user
     int size = _display.promptForGridSize();
@@ -49,22 +112,47 @@ void Game::gameLoop() {
     }
 
     // Step 1: Prompt for algorithm choice
-    int algorithm = _display.promptForAlgorithm();  // 1=A*, 2=UCS, 3=Greedy, 4=Weighted A*, 5=Beam Search
+    int algorithm = _display.promptForAlgorithm();  // 1=A*, 2=UCS, 3=Greedy, 4=Weighted A*, 5=Beam Search, 6=IDA*, 7=Bidirectional MM, 8=HDA*, 9=EPEA*, 10=Frontier A*, 11=External A*, 12=ARA*, 13=Beam-stack
     
     // Step 2: Prompt for heuristic based on algorithm (UCS returns 0)
-    int heuristic = _display.promptForHeuristic(algorithm);
+    int heuristic = _display.promptForHeuristic(algorithm, size);
     
     // Step 3: Prompt for algorithm-specific parameters
-    double weight = 1.0;  // For Weighted A*
-    int beamWidth = 100;  // For Beam Search
+    double weight = 1.0;  // For Weighted A* and ARA*
+    int beamWidth = 100;  // For Beam Search and beam-stack search
+    int threads = 1;      // For Beam Search, IDA* and HDA*
+    TieBreaking tieBreaking = TIE_HIGH_G;  // For the engines with an open list
+    size_t memoryBudgetMB = ExternalAstar::DEFAULT_MEMORY_MB;  // For External A*
+    
+    if (PatternDatabase::isPatternHeuristic(heuristic)) {
+        // Pattern databases - ask how to store the tables
+        PatternDatabase::setEncoding(
+            static_cast<PatternDatabase::Encoding>(_display.promptForPatternEncoding()));
+    }
     
     if (algorithm == 4) {
         // Weighted A* - ask for weight
         weight = _display.promptForWeight();
-    } else if (algorithm == 5) {
-        // Beam Search - ask for beam width
+    } else if (algorithm == 12) {
+        // ARA* - ask for the starting weight
+        weight = _display.promptForWeight(WeightedAstar::DEFAULT_ANYTIME_WEIGHT);
+    } else if (algorithm == 5 || algorithm == 13) {
+        // Beam Search and beam-stack search - ask for beam width
         beamWidth = _display.promptForBeamWidth();
     }
+    
+    if (algorithm == 5 || algorithm == 6 || algorithm == 8) {
+        // Beam Search, IDA* and HDA* - ask how many worker threads
+        threads = _display.promptForThreads();
+    } else if (algorithm == 11) {
+        // External A* - ask how much RAM its buffers may use
+        memoryBudgetMB = static_cast<size_t>(_display.promptForMemoryBudget());
+    }
+    
+    if (algorithm != 6 && algorithm != 7 && algorithm != 11 && algorithm != 13) {
+        // Engines with an open list - ask how to order equal-priority states
+        tieBreaking = static_cast<TieBreaking>(_display.promptForTieBreaking());
+    }
 
     // Map choices to names for display
     std::map<int, std::string> algorithmNames;
@@ -73,17 +161,19 @@ void Game::gameLoop() {
     algorithmNames[3] = "Greedy Search";
     algorithmNames[4] = "Weighted A*";
     algorithmNames[5] = "Beam Search";
+    algorithmNames[6] = "IDA*";
+    algorithmNames[7] = "Bidirectional MM";
+    algorithmNames[8] = "HDA*";
+    algorithmNames[9] = "EPEA*";
+    algorithmNames[10] = "Frontier A*";
+    algorithmNames[11] = "External A*";
+    algorithmNames[12] = "ARA*";
+    algorithmNames[13] = "Beam-stack Search";
     
-    std::map<int, std::string> heuristicNames;
-    heuristicNames[0] = "None (uninformed)";
-    heuristicNames[1] = "Manhattan Distance";
-    heuristicNames[2] = "Hamming Distance";
-    heuristicNames[3] = "Linear Conflict";
 
     std::string algorithmName = algorithmNames.count(algorithm) ? 
                                 algorithmNames[algorithm] : "Unknown";
-    std::string heuristicName = heuristicNames.count(heuristic) ? 
-                                heuristicNames[heuristic] : "Unknown";
+    std::string heuristicName = getHeuristicName(heuristic);
     
     // Combine for display
     std::string displayName;
@@ -115,23 +205,13 @@ void Game::gameLoop() {
     // Display the puzzle inline (convert flat to 2D for display)
     _display.displayPuzzleInline(puzzle.getGrid2D(), puzzle.getGoal2D());
 
-    // Route to appropriate algorithm based on user's choice
-    // All algorithms use the same time and memory limits defined in Game class
-    if (algorithm == 1) {
-        // A* - pass heuristic (1=Manhattan, 2=Hamming, 3=Linear Conflict)
-        _astar.solve(puzzle, size, heuristic, false, DEFAULT_MAX_STATES, DEFAULT_MAX_TIME);
-    } else if (algorithm == 2) {
-        // UCS - no heuristic needed (uses only g(n))
-        _ucs.solve(puzzle, size, false, DEFAULT_MAX_STATES, DEFAULT_MAX_TIME);
-    } else if (algorithm == 3) {
-        // Greedy Search - pass heuristic (1=Manhattan, 2=Hamming, 3=Linear Conflict)
-        _greedy.solve(puzzle, size, heuristic, false, DEFAULT_MAX_STATES, DEFAULT_MAX_TIME);
-    } else if (algorithm == 4) {
-        // Weighted A* - pass heuristic (1=Manhattan, 2=Hamming, 3=Linear Conflict) and weight
-        _weightedAstar.solve(puzzle, size, heuristic, false, DEFAULT_MAX_STATES, DEFAULT_MAX_TIME, weight);
-    } else if (algorithm == 5) {
-        // Beam Search - pass heuristic (1=Manhattan, 2=Hamming, 3=Linear Conflict) and beam width
-        _beamSearch.solve(puzzle, size, heuristic, false, DEFAULT_MAX_STATES, DEFAULT_MAX_TIME, beamWidth);
+    // Dispatch once to the engines specialised for this board size
+    switch (size) {
+        case 3: runSolver<3>(puzzle, algorithm, heuristic, weight, beamWidth, threads, tieBreaking, memoryBudgetMB); break;
+        case 4: runSolver<4>(puzzle, algorithm, heuristic, weight, beamWidth, threads, tieBreaking, memoryBudgetMB); break;
+        case 5: runSolver<5>(puzzle, algorithm, heuristic, weight, beamWidth, threads, tieBreaking, memoryBudgetMB); break;
+        case 6: runSolver<6>(puzzle, algorithm, heuristic, weight, beamWidth, threads, tieBreaking, memoryBudgetMB); break;
+        case 7: runSolver<7>(puzzle, algorithm, heuristic, weight, beamWidth, threads, tieBreaking, memoryBudgetMB); break;
+        case 8: runSolver<8>(puzzle, algorithm, heuristic, weight, beamWidth, threads, tieBreaking, memoryBudgetMB); break;
     }
 }
-
@@ -1,10 +1,10 @@
 #include "../includes/Greedy.hpp"
 #include "../includes/Heuristic.hpp"
 #include "../includes/SolutionLogger.hpp"
+#include "../includes/StateTable.hpp"
+#include "../includes/NodeArena.hpp"
+#include "../includes/BucketQueue.hpp"
 #include <iostream>
-#include <queue>
-#include <unordered_set>
-#include <unordered_map>
 #include <chrono>
 #include <iomanip>
 #include <algorithm>
@@ -25,85 +25,69 @@ Greedy& Greedy::operator=(const Greedy& other) {
 }
 
 // Estimate memory usage in bytes
+template <int N>
 size_t Greedy::estimateMemoryUsage(size_t numStates) {
-    const size_t BYTES_PER_NODE = 60;
-    const size_t HASH_OVERHEAD = 16;
-    return numStates * (BYTES_PER_NODE + HASH_OVERHEAD * 2);
+    // Arena node plus its open-list pointer; no parent chain is kept alive
+    const size_t BYTES_PER_NODE = sizeof(Node<N>) + sizeof(Node<N>*);
+    return numStates * (BYTES_PER_NODE + StateTable<N, SearchEntry>::bytesPerEntry());
 }
 
-void Greedy::getNeighbors(const Node& node, std::vector<Neighbor>& neighbors) {
+template <int N>
+void Greedy::getNeighbors(const Node<N>& node, std::vector<Neighbor<N>>& neighbors) {
     neighbors.clear();
     
-    const std::vector<uint8_t>& state = node.getState();
-    int size = node.getSize();
+    const State<N>& state = node.getState();
     uint8_t zeroPos = node.getZeroPos();
     
-    int row = zeroPos / size;
-    int col = zeroPos % size;
-    
-    // Define possible moves: up, down, left, right
-    struct Move {
-        int dr, dc;
-        const char* action;
-    };
-    
-    static const Move moves[] = {
-        {-1, 0, "up"},
-        {1, 0, "down"},
-        {0, -1, "left"},
-        {0, 1, "right"}
-    };
-    
-    neighbors.reserve(4);
-    
-    for (const auto& move : moves) {
-        int newRow = row + move.dr;
-        int newCol = col + move.dc;
+    for (int move = 0; move < MOVE_COUNT; move++) {
+        int newZeroPos = Board<N>::NEIGHBORS[zeroPos][move];
         
         // Check if move is valid
-        if (newRow >= 0 && newRow < size && newCol >= 0 && newCol < size) {
-            uint8_t newZeroPos = newRow * size + newCol;
-            
-            // Create new state by swapping blank with target tile
-            std::vector<uint8_t> newState = state;
-            std::swap(newState[zeroPos], newState[newZeroPos]);
+        if (newZeroPos != Board<N>::NO_CELL) {
+            // Create new state by sliding the target tile into the blank
+            State<N> newState = state;
+            newState.slide(zeroPos, newZeroPos);
             
-            // Use emplace_back with move semantics to avoid extra copy
-            neighbors.emplace_back(Neighbor{std::move(newState), newZeroPos, move.action});
+            neighbors.emplace_back(Neighbor<N>{newState, static_cast<uint8_t>(newZeroPos), static_cast<uint8_t>(move)});
         }
     }
 }
 
-bool Greedy::isGoal(const std::vector<uint8_t>& state,
-                    const std::vector<uint8_t>& goal) {
+template <int N>
+bool Greedy::isGoal(const State<N>& state, const State<N>& goal) {
     return state == goal;
 }
 
-AStarResult Greedy::solve(Puzzle& puzzle, int size, int heuristic, bool silent, 
-                          size_t maxStates, double maxTimeSeconds) {
+template <int N>
+AStarResult Greedy::solve(Puzzle& puzzle, int heuristic, bool silent, 
+                          size_t maxStates, double maxTimeSeconds, TieBreaking tieBreaking) {
     auto startTime = std::chrono::high_resolution_clock::now();
     
     // Get initial state and goal
     const std::vector<uint8_t>& initialState = puzzle.getGrid();
     const std::vector<uint8_t>& goal = puzzle.getGoal();
     
+    // Packed search representation of the start and goal boards
+    const State<N> initial(initialState);
+    const State<N> goalState(goal);
+    
     // Display memory and time limits (set by Game class)
     if (!silent) {
-        size_t estimatedMB = estimateMemoryUsage(maxStates) / (1024 * 1024);
+        size_t estimatedMB = estimateMemoryUsage<N>(maxStates) / (1024 * 1024);
         std::cout << "\n[Memory Safety] Max states limited to " << maxStates 
                  << " (~" << estimatedMB << " MB)\n";
         std::cout << "[Time Safety] Max execution time: " << maxTimeSeconds << " seconds\n";
     }
     
     // Check if already at goal
-    if (isGoal(initialState, goal)) {
+    if (isGoal(initial, goalState)) {
         if (!silent) {
             std::cout << "\nPuzzle is already solved!\n";
         }
         auto endTime = std::chrono::high_resolution_clock::now();
         double duration = std::chrono::duration<double>(endTime - startTime).count();
         
-        return {true, 0, 0, 0, duration, heuristic, "", 1, "Greedy Search", false, "", 1.0};
+        return {true, 0, 0, 0, duration, heuristic, "", 1, "Greedy Search", false, "", 1.0, {}, tieBreaking};
     }
     
     // Check if puzzle is solvable
@@ -115,11 +99,11 @@ AStarResult Greedy::solve(Puzzle& puzzle, int size, int heuristic, bool silent,
         double duration = std::chrono::duration<double>(endTime - startTime).count();
         
         return {false, 0, 0, 0, duration, heuristic, "", 1, "Greedy Search", false, 
-                "Puzzle is unsolvable", 1.0};
+                "Puzzle is unsolvable", 1.0, {}, tieBreaking};
     }
     
-    // Pre-compute goal lookup table once
-    GoalLookup goalLookup(goal, size);
+    // Goal lookup and per-move delta tables, built once per goal and heuristic
+    const Heuristic<N>& estimator = Heuristic<N>::get(goal, heuristic);
     
     // Initialize statistics
     int totalSetOpened = 0;
@@ -135,26 +119,27 @@ AStarResult Greedy::solve(Puzzle& puzzle, int size, int heuristic, bool silent,
     }
     
     // Calculate initial heuristic
-    int initialH = Heuristic::getHeuristicValue(initialState, goalLookup, size, heuristic);
+    HeuristicCache<N> initialCache;
+    int initialH = estimator.evaluate(initial, initialCache);
     
-    // For Greedy Search: f(n) = h(n), so we set g=0 (with optional parent tracking for logging)
-    auto startNode = std::make_shared<Node>(initialState, size, initialZeroPos, 0, initialH, nullptr, "");
+    // All nodes of this search live in one arena, released in one shot on return
+    NodeArena<Node<N>> nodes;
     
-    // Priority queue for open set
-    std::priority_queue<std::shared_ptr<Node>, 
-                       std::vector<std::shared_ptr<Node>>, 
-                       NodePtrComparator> openSet;
-    openSet.push(startNode);
+    // For Greedy Search: f(n) = h(n), so we set g=0
+    Node<N>* startNode = nodes.create(initial, initialZeroPos, 0, initialH, initialCache);
     
-    // Set to track visited states (closed set)
-    std::unordered_set<size_t> closedSet;
+    // Open set bucketed by h(n) (nodes carry g = 0, so f = h)
+    BucketQueue<Node<N>*> openSet(tieBreaking);
+    openSet.push(startNode);
     
-    // Dictionary to track real path cost to reach each state
-    std::unordered_map<size_t, int> gScores;
-    gScores[startNode->hash()] = 0;
+    // Closed set and best path costs in one open-addressing table keyed by
+    // the full board (no hash-collision pruning, one probe per child)
+    StateTable<N, SearchEntry> table(maxStates);
+    bool startInserted;
+    table.findOrInsert(initial, startInserted) = SearchEntry{0, false, MOVE_UP};
     
     // Reusable neighbor vector
-    std::vector<Neighbor> neighbors;
+    std::vector<Neighbor<N>> neighbors;
     neighbors.reserve(4);
     
     while (!openSet.empty()) {
@@ -179,12 +164,13 @@ AStarResult Greedy::solve(Puzzle& puzzle, int size, int heuristic, bool silent,
                 }
                 
                 return {false, 0, totalSetOpened, maxStatesEnqueued, elapsed, heuristic, "", 
-                        1, "Greedy Search", false, "Timeout reached", 1.0};
+                        1, "Greedy Search", false, "Timeout reached", 1.0, {}, tieBreaking};
             }
         }
         
-        // Memory limit check
-        if (totalSetOpened >= static_cast<int>(maxStates)) {
+        // Memory limit check - every node created stays in the arena until
+        // the search returns, so count those rather than expansions
+        if (nodes.size() >= maxStates) {
             auto endTime = std::chrono::high_resolution_clock::now();
             double duration = std::chrono::duration<double>(endTime - startTime).count();
             
@@ -195,24 +181,23 @@ AStarResult Greedy::solve(Puzzle& puzzle, int size, int heuristic, bool silent,
                 std::cout << "Explored " << totalSetOpened << " states before hitting limit\n";
                 std::cout << "Maximum states in memory: " << maxStatesEnqueued << "\n";
                 std::cout << "Estimated memory used: " 
-                         << (estimateMemoryUsage(totalSetOpened) / (1024 * 1024)) << " MB\n";
+                         << (estimateMemoryUsage<N>(totalSetOpened) / (1024 * 1024)) << " MB\n";
                 std::cout << "Execution time: " << std::fixed << std::setprecision(4) 
                          << duration << "s\n";
             }
             
             return {false, 0, totalSetOpened, maxStatesEnqueued, duration, heuristic, "", 
-                    1, "Greedy Search", true, "Memory limit reached", 1.0};
+                    1, "Greedy Search", true, "Memory limit reached", 1.0, {}, tieBreaking};
         }
         
         // Get node with lowest f value (which is just h for greedy)
-        auto current = openSet.top();
+        Node<N>* current = openSet.top();
         openSet.pop();
         
         // Check if we reached the goal
-        if (isGoal(current->getState(), goal)) {
-            // Get real path cost from gScores
-            size_t goalHash = current->hash();
-            int moves = gScores[goalHash];
+        if (isGoal(current->getState(), goalState)) {
+            // Get real path cost from the table (the node only carries the sort key)
+            int moves = table.find(current->getState())->g;
             
             auto endTime = std::chrono::high_resolution_clock::now();
             double duration = std::chrono::duration<double>(endTime - startTime).count();
@@ -224,32 +209,31 @@ AStarResult Greedy::solve(Puzzle& puzzle, int size, int heuristic, bool silent,
                 std::cout << "Total moves required: " << moves << "\n";
                 std::cout << "Total states opened (time complexity): " << totalSetOpened << "\n";
                 std::cout << "Maximum states in memory (space complexity): " << maxStatesEnqueued << "\n";
+                std::cout << "Tie-breaking: " << getTieBreakingName(tieBreaking) << "\n";
                 std::cout << "Execution time: " << std::fixed << std::setprecision(4) 
                          << duration << "s\n";
                 std::cout << std::string(50, '=') << "\n";
                 
                 // Log solution to file
-                std::string heuristicName;
-                if (heuristic == 1) heuristicName = "Manhattan Distance";
-                else if (heuristic == 2) heuristicName = "Hamming Distance";
-                else if (heuristic == 3) heuristicName = "Linear Conflict";
+                std::string heuristicName = getHeuristicName(heuristic);
                 
                 SolutionLogger::logSolution(
-                    "Greedy Search", heuristicName, initialState, goal, size,
-                    current, moves, totalSetOpened, maxStatesEnqueued, duration
+                    "Greedy Search", heuristicName, initialState, goal, N,
+                    tracePath(table, initial, current->getState()), moves, totalSetOpened, maxStatesEnqueued, duration
                 );
             }
             
             return {true, moves, totalSetOpened, maxStatesEnqueued, duration, heuristic, "", 
-                    1, "Greedy Search", false, "", 1.0};
+                    1, "Greedy Search", false, "", 1.0, {}, tieBreaking};
         }
         
-        // Add current state to closed set
-        size_t currentHash = current->hash();
-        if (closedSet.find(currentHash) != closedSet.end()) {
+        // Add current state to closed set (its entry was created when it was pushed)
+        SearchEntry* currentEntry = table.find(current->getState());
+        if (currentEntry->closed) {
             continue;
         }
-        closedSet.insert(currentHash);
+        currentEntry->closed = true;
+        int currentG = currentEntry->g;  // Copied: inserting children may move the entry
         totalSetOpened++;
         
         // Generate and process neighbors
@@ -257,39 +241,35 @@ AStarResult Greedy::solve(Puzzle& puzzle, int size, int heuristic, bool silent,
         
         for (auto& neighbor : neighbors) {
             // Calculate real g-cost (actual path cost)
-            int realGCost = gScores[currentHash] + 1;
+            int realGCost = currentG + 1;
+            
+            // One probe: skip closed states and paths that are not better
+            bool inserted;
+            SearchEntry& entry = table.findOrInsert(neighbor.state, inserted);
+            if (!inserted && (entry.closed || entry.g <= realGCost)) {
+                continue;
+            }
+            
+            // Record the real path cost (for solution reporting)
+            entry.g = realGCost;
+            entry.move = neighbor.move;
             
             // Calculate heuristic - for greedy, we use g=0 in the node
             // so f(n) = 0 + h(n) = h(n)
-            int hCost = Heuristic::getHeuristicValue(neighbor.state, goalLookup, size, heuristic);
+            // Only the slid tile changed: update the parent's cached heuristic parts
+            HeuristicCache<N> cache;
+            int hCost = estimator.evaluateMove(neighbor.state, current->getZeroPos(), neighbor.move,
+                                               current->getHeuristicCache(), cache);
             
             // Create neighbor node with g=0 for greedy behavior
-            auto neighborNode = std::make_shared<Node>(
-                std::move(neighbor.state),
-                size,
+            Node<N>* neighborNode = nodes.create(
+                neighbor.state,
                 neighbor.zeroPos,
                 0,      // g=0 for greedy search (f = h only)
                 hCost,  // h for sorting
-                current,  // Track parent for path reconstruction
-                neighbor.action  // Track action that led to this state
+                cache
             );
             
-            size_t neighborHash = neighborNode->hash();
-            
-            // Skip if already visited
-            if (closedSet.find(neighborHash) != closedSet.end()) {
-                continue;
-            }
-            
-            // Check if this is a better path to this state
-            if (gScores.find(neighborHash) != gScores.end() && 
-                gScores[neighborHash] <= realGCost) {
-                continue;
-            }
-            
-            // Record the real path cost (for solution reporting)
-            gScores[neighborHash] = realGCost;
-            
             // Add to open set
             openSet.push(neighborNode);
         }
@@ -311,6 +291,9 @@ AStarResult Greedy::solve(Puzzle& puzzle, int size, int heuristic, bool silent,
     }
     
     return {false, 0, totalSetOpened, maxStatesEnqueued, duration, heuristic, "", 
-            1, "Greedy Search", false, "No solution found", 1.0};
+            1, "Greedy Search", false, "No solution found", 1.0, {}, tieBreaking};
 }
 
+#define INSTANTIATE_GREEDY(N) \
+    template AStarResult Greedy::solve<N>(Puzzle&, int, bool, size_t, double, TieBreaking);
+NPUZZLE_FOR_EACH_SIZE(INSTANTIATE_GREEDY)
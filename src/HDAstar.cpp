@@ -0,0 +1,404 @@
+#include "../includes/HDAstar.hpp"
+#include "../includes/SolutionLogger.hpp"
+#include <iostream>
+#include <iomanip>
+#include <algorithm>
+#include <climits>
+#include <thread>
+
+HDAstar::HDAstar() {}
+
+HDAstar::~HDAstar() {}
+
+HDAstar::HDAstar(const HDAstar& other) {
+    (void)other;
+}
+
+HDAstar& HDAstar::operator=(const HDAstar& other) {
+    (void)other;
+    return *this;
+}
+
+template <int N>
+HDAstar::Shared<N>::Shared(int threads)
+    : goal(nullptr), estimator(nullptr), inboxes(threads), bestCost(INT_MAX), active(threads),
+      expanded(0), stop(false), memoryLimitReached(false), startTime(), maxTimeSeconds(0),
+      maxStates(0) {}
+
+template <int N>
+HDAstar::Worker<N>::Worker(size_t expectedStates, int threads, TieBreaking tieBreaking)
+    : table(expectedStates), nodes(), open(tieBreaking), outboxes(threads), expanded(0), maxOpen(0) {}
+
+template <int N>
+size_t HDAstar::ownerOf(const State<N>& state, size_t workers) {
+    // High hash bits: the tables index their slots with the low ones
+    return (state.hash() >> 40) % workers;
+}
+
+template <int N>
+void HDAstar::receive(Shared<N>& shared, Worker<N>& worker, const Message<N>& message) {
+    // Same skip-or-reopen rule as A*
+    bool inserted;
+    SearchEntry& entry = worker.table.findOrInsert(message.state, inserted);
+    if (!inserted && entry.g <= message.g) {
+        return;
+    }
+    entry.g = message.g;
+    entry.closed = false;
+    entry.move = message.move;
+
+    // Nothing at or above the best goal cost can lead to a cheaper one
+    if (message.g + message.h >= shared.bestCost.load(std::memory_order_relaxed)) {
+        return;
+    }
+    worker.open.push(worker.nodes.create(message.state, message.zeroPos, message.g, message.h,
+                                         message.cache));
+    worker.maxOpen = std::max(worker.maxOpen, static_cast<int>(worker.open.size()));
+}
+
+template <int N>
+void HDAstar::flush(Shared<N>& shared, Worker<N>& worker, size_t destination) {
+    std::vector<Message<N>>& outbox = worker.outboxes[destination];
+    if (outbox.empty()) {
+        return;
+    }
+
+    // Counted before they become visible, so the search cannot look finished
+    // while they are in flight
+    shared.active.fetch_add(static_cast<long long>(outbox.size()));
+    Inbox<N>& inbox = shared.inboxes[destination];
+    std::lock_guard<std::mutex> lock(inbox.mutex);
+    inbox.messages.insert(inbox.messages.end(), outbox.begin(), outbox.end());
+    outbox.clear();
+}
+
+template <int N>
+bool HDAstar::hasOpenWork(Shared<N>& shared, Worker<N>& worker) {
+    // Nodes superseded by a shorter path stay in the open list until they surface
+    while (!worker.open.empty()) {
+        const Node<N>* top = worker.open.top();
+        const SearchEntry* entry = worker.table.find(top->getState());
+        if (!entry->closed && top->getCost() == entry->g) {
+            return top->getFValue() < shared.bestCost.load(std::memory_order_relaxed);
+        }
+        worker.open.pop();
+    }
+    return false;
+}
+
+template <int N>
+void HDAstar::expand(Shared<N>& shared, Worker<N>& worker, size_t self) {
+    Node<N>* current = worker.open.top();
+    worker.open.pop();
+    const State<N>& state = current->getState();
+
+    // A goal only lowers the bound; the search goes on until nothing beats it
+    if (state == *shared.goal) {
+        int best = shared.bestCost.load();
+        while (current->getCost() < best
+               && !shared.bestCost.compare_exchange_weak(best, current->getCost())) {
+        }
+        return;
+    }
+
+    worker.table.find(state)->closed = true;
+    worker.expanded++;
+
+    int zeroPos = current->getZeroPos();
+    int gCost = current->getCost() + 1;
+    int bound = shared.bestCost.load(std::memory_order_relaxed);
+    size_t workers = worker.outboxes.size();
+
+    for (int move = 0; move < MOVE_COUNT; move++) {
+        int newZeroPos = Board<N>::NEIGHBORS[zeroPos][move];
+        if (newZeroPos == Board<N>::NO_CELL) {
+            continue;
+        }
+
+        Message<N> child;
+        child.state = state;
+        child.state.slide(zeroPos, newZeroPos);
+        child.zeroPos = static_cast<uint8_t>(newZeroPos);
+        child.move = static_cast<uint8_t>(move);
+        child.g = gCost;
+        child.h = shared.estimator->evaluateMove(child.state, zeroPos, move,
+                                                 current->getHeuristicCache(), child.cache);
+        if (child.g + child.h >= bound) {
+            continue;
+        }
+
+        size_t owner = ownerOf(child.state, workers);
+        if (owner == self) {
+            receive(shared, worker, child);
+            continue;
+        }
+        worker.outboxes[owner].push_back(child);
+        if (worker.outboxes[owner].size() >= BATCH_SIZE) {
+            flush(shared, worker, owner);
+        }
+    }
+}
+
+template <int N>
+void HDAstar::run(Shared<N>& shared, Worker<N>& worker, size_t self) {
+    std::vector<Message<N>> incoming;
+    bool idle = false;
+    long long reported = 0;
+
+    while (!shared.stop.load(std::memory_order_relaxed)) {
+        // Take everything posted to this worker in one swap
+        {
+            Inbox<N>& inbox = shared.inboxes[self];
+            std::lock_guard<std::mutex> lock(inbox.mutex);
+            incoming.swap(inbox.messages);
+        }
+        if (!incoming.empty()) {
+            // Busy again before the messages stop counting as in flight
+            if (idle) {
+                shared.active.fetch_add(1);
+                idle = false;
+            }
+            for (const Message<N>& message : incoming) {
+                receive(shared, worker, message);
+            }
+            shared.active.fetch_sub(static_cast<long long>(incoming.size()));
+            incoming.clear();
+        }
+
+        int expansions = 0;
+        while (expansions < EXPANSIONS_PER_ROUND && hasOpenWork(shared, worker)) {
+            expand(shared, worker, self);
+            expansions++;
+        }
+        for (size_t destination = 0; destination < worker.outboxes.size(); destination++) {
+            flush(shared, worker, destination);
+        }
+
+        if (expansions > 0) {
+            // Limits are checked once per round
+            long long total = shared.expanded.fetch_add(worker.expanded - reported) +
+                              (worker.expanded - reported);
+            reported = worker.expanded;
+            double elapsed = std::chrono::duration<double>(
+                std::chrono::high_resolution_clock::now() - shared.startTime).count();
+            if (shared.maxTimeSeconds > 0 && elapsed > shared.maxTimeSeconds) {
+                shared.stop.store(true);
+            } else if (total >= static_cast<long long>(shared.maxStates)) {
+                shared.memoryLimitReached.store(true);
+                shared.stop.store(true);
+            }
+            continue;
+        }
+
+        // Nothing left below the bound: idle, and done once every worker is
+        // idle with no message left to receive
+        if (!idle) {
+            idle = true;
+            shared.active.fetch_sub(1);
+        }
+        if (shared.active.load() == 0) {
+            break;
+        }
+        std::this_thread::yield();
+    }
+}
+
+template <int N>
+std::vector<uint8_t> HDAstar::tracePath(const std::vector<std::unique_ptr<Worker<N>>>& workers,
+                                        const State<N>& initial, const State<N>& goal) {
+    std::vector<uint8_t> path;
+
+    State<N> state = goal;
+    int zeroPos = 0;
+    while (state.get(zeroPos) != 0) {
+        zeroPos++;
+    }
+
+    // As ::tracePath, reading each state's entry from the table of its owner
+    while (state != initial) {
+        const SearchEntry* entry = workers[ownerOf(state, workers.size())]->table.find(state);
+        uint8_t move = entry->move;
+        path.push_back(move);
+
+        int previousZeroPos = Board<N>::NEIGHBORS[zeroPos][move ^ 1];
+        state.slide(zeroPos, previousZeroPos);
+        zeroPos = previousZeroPos;
+    }
+
+    std::reverse(path.begin(), path.end());
+    return path;
+}
+
+template <int N>
+AStarResult HDAstar::solve(Puzzle& puzzle, int heuristic, bool silent, size_t maxStates,
+                           double maxTimeSeconds, int threads, TieBreaking tieBreaking) {
+    auto startTime = std::chrono::high_resolution_clock::now();
+    threads = std::max(1, threads);
+
+    // Get initial state and goal
+    const std::vector<uint8_t>& initialState = puzzle.getGrid();
+    const std::vector<uint8_t>& goal = puzzle.getGoal();
+
+    // Packed search representation of the start and goal boards
+    const State<N> initial(initialState);
+    const State<N> goalState(goal);
+
+    // Display memory and time limits (set by Game class)
+    if (!silent) {
+        // Arena node, open-list pointer and table slot per state, as in A*
+        size_t bytesPerState = sizeof(Node<N>) + sizeof(Node<N>*)
+                               + StateTable<N, SearchEntry>::bytesPerEntry();
+        size_t estimatedMB = maxStates * bytesPerState / (1024 * 1024);
+        std::cout << "\n[Memory Safety] Max states limited to " << maxStates
+                 << " (~" << estimatedMB << " MB, all workers)\n";
+        std::cout << "[Time Safety] Max execution time: " << maxTimeSeconds << " seconds\n";
+        std::cout << "[Threads] " << threads << " workers, states distributed by hash\n";
+    }
+
+    // Check if already at goal
+    if (initial == goalState) {
+        if (!silent) {
+            std::cout << "\nPuzzle is already solved!\n";
+        }
+        auto endTime = std::chrono::high_resolution_clock::now();
+        double duration = std::chrono::duration<double>(endTime - startTime).count();
+
+        return {true, 0, 0, 0, duration, heuristic, "", 10, "HDA*", false, "", 1.0, {}, tieBreaking};
+    }
+
+    // Check if puzzle is solvable
+    if (!puzzle.isSolvable()) {
+        if (!silent) {
+            std::cout << "\nPuzzle is unsolvable!\n";
+
+            // Log failure to file
+            std::string heuristicName = getHeuristicName(heuristic);
+
+            SolutionLogger::logFailure(
+                "HDA*", heuristicName, initialState, goal, N,
+                "Puzzle is unsolvable", 0, 0, 0
+            );
+        }
+        auto endTime = std::chrono::high_resolution_clock::now();
+        double duration = std::chrono::duration<double>(endTime - startTime).count();
+
+        return {false, 0, 0, 0, duration, heuristic, "", 10, "HDA*", false, "Puzzle is unsolvable", 1.0, {}, tieBreaking};
+    }
+
+    // Goal lookup and per-move delta tables, built once per goal and heuristic, shared read-only
+    const Heuristic<N>& estimator = Heuristic<N>::get(goal, heuristic);
+
+    Shared<N> shared(threads);
+    shared.goal = &goalState;
+    shared.estimator = &estimator;
+    shared.startTime = startTime;
+    shared.maxTimeSeconds = maxTimeSeconds;
+    shared.maxStates = maxStates;
+
+    std::vector<std::unique_ptr<Worker<N>>> workers;
+    for (int i = 0; i < threads; i++) {
+        workers.emplace_back(new Worker<N>(maxStates / threads, threads, tieBreaking));
+    }
+
+    // The start goes straight to its owner
+    Message<N> start;
+    start.state = initial;
+    start.zeroPos = static_cast<uint8_t>(
+        std::find(initialState.begin(), initialState.end(), 0) - initialState.begin());
+    start.move = MOVE_UP;
+    start.g = 0;
+    start.h = estimator.evaluate(initial, start.cache);
+    receive(shared, *workers[ownerOf(initial, workers.size())], start);
+
+    std::vector<std::thread> pool;
+    for (int i = 1; i < threads; i++) {
+        pool.emplace_back(run<N>, std::ref(shared), std::ref(*workers[i]), static_cast<size_t>(i));
+    }
+    run(shared, *workers[0], 0);
+    for (std::thread& thread : pool) {
+        thread.join();
+    }
+
+    auto endTime = std::chrono::high_resolution_clock::now();
+    double duration = std::chrono::duration<double>(endTime - startTime).count();
+
+    std::vector<long long> threadNodes;
+    long long expanded = 0;
+    int maxStatesEnqueued = 0;
+    for (const std::unique_ptr<Worker<N>>& worker : workers) {
+        threadNodes.push_back(worker->expanded);
+        expanded += worker->expanded;
+        maxStatesEnqueued += worker->maxOpen;
+    }
+    int totalSetOpened = static_cast<int>(std::min<long long>(expanded, INT_MAX));
+    int bestCost = shared.bestCost.load();
+
+    // Stopped by a limit, the best goal so far is not proven optimal
+    if (!shared.stop.load() && bestCost != INT_MAX) {
+        int moves = bestCost;
+
+        if (!silent) {
+            std::cout << "\n" << std::string(50, '=') << "\n";
+            std::cout << "Solution found!\n";
+            std::cout << std::string(50, '=') << "\n";
+            std::cout << "Total moves required: " << moves << "\n";
+            std::cout << "Total states opened (time complexity): " << totalSetOpened << "\n";
+            std::cout << "Maximum states in memory (space complexity): " << maxStatesEnqueued << "\n";
+            std::cout << "Tie-breaking: " << getTieBreakingName(tieBreaking) << "\n";
+            for (size_t i = 0; i < threadNodes.size(); i++) {
+                std::cout << "  Thread " << i << " states opened: " << threadNodes[i] << "\n";
+            }
+            std::cout << "Execution time: " << std::fixed << std::setprecision(4)
+                     << duration << "s\n";
+            std::cout << std::string(50, '=') << "\n";
+
+            // Log solution to file
+            std::string heuristicName = getHeuristicName(heuristic);
+
+            SolutionLogger::logSolution(
+                "HDA*", heuristicName, initialState, goal, N,
+                tracePath(workers, initial, goalState), moves, totalSetOpened, maxStatesEnqueued, duration
+            );
+        }
+
+        return {true, moves, totalSetOpened, maxStatesEnqueued, duration, heuristic, "",
+                10, "HDA*", false, "", 1.0, threadNodes, tieBreaking};
+    }
+
+    bool memoryLimitReached = shared.memoryLimitReached.load();
+    std::string reason = memoryLimitReached ? "Memory limit reached"
+                         : shared.stop.load() ? "Timeout reached" : "No solution found";
+    if (!silent) {
+        std::cout << "\n" << std::string(50, '=') << "\n";
+        if (memoryLimitReached) {
+            std::cout << "⚠️  MEMORY LIMIT REACHED!\n";
+        } else if (shared.stop.load()) {
+            std::cout << "⏱️  TIMEOUT REACHED!\n";
+        } else {
+            std::cout << "No solution found! Puzzle may be unsolvable.\n";
+        }
+        std::cout << std::string(50, '=') << "\n";
+        std::cout << "Explored " << totalSetOpened << " states\n";
+        std::cout << "Maximum states in memory: " << maxStatesEnqueued << "\n";
+        for (size_t i = 0; i < threadNodes.size(); i++) {
+            std::cout << "  Thread " << i << " states opened: " << threadNodes[i] << "\n";
+        }
+        std::cout << "Execution time: " << std::fixed << std::setprecision(4)
+                 << duration << "s\n";
+
+        // Log failure to file
+        std::string heuristicName = getHeuristicName(heuristic);
+
+        SolutionLogger::logFailure(
+            "HDA*", heuristicName, initialState, goal, N,
+            reason, totalSetOpened, maxStatesEnqueued, duration
+        );
+    }
+
+    return {false, 0, totalSetOpened, maxStatesEnqueued, duration, heuristic, "",
+            10, "HDA*", memoryLimitReached, reason, 1.0, threadNodes, tieBreaking};
+}
+
+#define INSTANTIATE_HDASTAR(N) \
+    template AStarResult HDAstar::solve<N>(Puzzle&, int, bool, size_t, double, int, TieBreaking);
+NPUZZLE_FOR_EACH_SIZE(INSTANTIATE_HDASTAR)
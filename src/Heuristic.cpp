@@ -1,50 +1,305 @@
 #include "../includes/Heuristic.hpp"
 #include <cmath>
 #include <algorithm>
+#include <map>
+#include <mutex>
+#include <utility>
+
+template <int N>
+GoalLookup<N>::GoalLookup() : position(), row(), col() {}
 
 // GoalLookup constructor - pre-compute all goal positions
-GoalLookup::GoalLookup(const std::vector<uint8_t>& goal, int size) {
-    int total = size * size;
-    position.resize(total);
-    row.resize(total);
-    col.resize(total);
-    
-    for (int i = 0; i < total; i++) {
+template <int N>
+GoalLookup<N>::GoalLookup(const std::vector<uint8_t>& goal) : position(), row(), col() {
+    for (int i = 0; i < Board<N>::CELLS; i++) {
         uint8_t value = goal[i];
         if (value != 0) {
             position[value] = i;
-            row[value] = i / size;
-            col[value] = i % size;
+            row[value] = Board<N>::ROW[i];
+            col[value] = Board<N>::COL[i];
         }
     }
 }
 
-Heuristic::Heuristic() {}
+template <int N>
+Heuristic<N>::Heuristic()
+    : _goalLookup(), _heuristic(0), _patterns(nullptr), _rowWalking(nullptr),
+      _colWalking(nullptr), _delta() {}
 
-Heuristic::~Heuristic() {}
-
-Heuristic::Heuristic(const Heuristic& other) {
-    (void)other;
+template <int N>
+Heuristic<N>::Heuristic(const std::vector<uint8_t>& goal, int heuristic)
+    : _goalLookup(goal), _heuristic(heuristic), _patterns(nullptr), _rowWalking(nullptr),
+      _colWalking(nullptr), _delta() {
+    if (PatternDatabase::isPatternHeuristic(heuristic)) {
+        // Pattern databases only exist for 4x4; elsewhere use Linear Conflict
+        if (N == PatternDatabase::SIZE) {
+            _patterns = &PatternDatabase::get(goal, heuristic);
+        } else {
+            _heuristic = 3;
+        }
+    }
+    if (heuristic == 7 || heuristic == 8) {
+        // Walking distance tables stop at 4x4; larger boards use Linear Conflict
+        if (WalkingDistance::isSupported(N)) {
+            int blank = 0;
+            for (int i = 0; i < Board<N>::CELLS; i++) {
+                if (goal[i] == 0) {
+                    blank = i;
+                }
+            }
+            _rowWalking = &WalkingDistance::get(N, Board<N>::ROW[blank]);
+            _colWalking = &WalkingDistance::get(N, Board<N>::COL[blank]);
+        } else {
+            _heuristic = 3;
+        }
+    }
+    buildDeltaTable();
 }
 
-Heuristic& Heuristic::operator=(const Heuristic& other) {
-    (void)other;
+template <int N>
+Heuristic<N>::~Heuristic() {}
+
+template <int N>
+Heuristic<N>::Heuristic(const Heuristic& other)
+    : _goalLookup(other._goalLookup), _heuristic(other._heuristic),
+      _patterns(other._patterns), _rowWalking(other._rowWalking),
+      _colWalking(other._colWalking), _delta(other._delta) {}
+
+template <int N>
+Heuristic<N>& Heuristic<N>::operator=(const Heuristic& other) {
+    if (this != &other) {
+        _goalLookup = other._goalLookup;
+        _heuristic = other._heuristic;
+        _patterns = other._patterns;
+        _rowWalking = other._rowWalking;
+        _colWalking = other._colWalking;
+        _delta = other._delta;
+    }
     return *this;
 }
 
-int Heuristic::manhattanDistance(const std::vector<uint8_t>& state, 
-                                 const GoalLookup& goalLookup, int size) {
+template <int N>
+const Heuristic<N>& Heuristic<N>::get(const std::vector<uint8_t>& goal, int heuristic) {
+    static std::map<std::pair<std::vector<uint8_t>, int>, Heuristic> estimators;
+    static std::mutex estimatorsMutex;
+
+    std::lock_guard<std::mutex> lock(estimatorsMutex);
+    std::pair<std::vector<uint8_t>, int> key(goal, heuristic);
+    auto it = estimators.find(key);
+    if (it != estimators.end()) {
+        return it->second;
+    }
+    Heuristic& estimator = estimators[key];
+    estimator = Heuristic(goal, heuristic);
+    return estimator;
+}
+
+template <int N>
+int Heuristic<N>::tileDistance(uint8_t tile, int cell) const {
+    switch (_heuristic) {
+        case 2:
+            // Hamming: 1 when the tile is misplaced
+            return _goalLookup.position[tile] != cell ? 1 : 0;
+        case 0:
+        case 4:
+            // Uninformed: nothing to track
+            return 0;
+        default:
+            // Manhattan, also the base of Linear Conflict and of the default case
+            return std::abs(Board<N>::ROW[cell] - _goalLookup.row[tile])
+                 + std::abs(Board<N>::COL[cell] - _goalLookup.col[tile]);
+    }
+}
+
+template <int N>
+void Heuristic<N>::buildDeltaTable() {
+    for (int tile = 1; tile < Board<N>::CELLS; tile++) {
+        for (int from = 0; from < Board<N>::CELLS; from++) {
+            for (int direction = 0; direction < MOVE_COUNT; direction++) {
+                int to = Board<N>::NEIGHBORS[from][direction];
+                if (to == Board<N>::NO_CELL) {
+                    continue;
+                }
+                _delta[tile][from][direction] = static_cast<int8_t>(
+                    tileDistance(static_cast<uint8_t>(tile), to)
+                    - tileDistance(static_cast<uint8_t>(tile), from));
+            }
+        }
+    }
+}
+
+template <int N>
+void Heuristic<N>::locateTiles(const State<N>& state, uint8_t* cellOf) {
+    for (int i = 0; i < Board<N>::CELLS; i++) {
+        cellOf[state.get(i)] = static_cast<uint8_t>(i);
+    }
+}
+
+template <int N>
+int Heuristic<N>::walkingPatterns(const State<N>& state, const GoalLookup<N>& goalLookup,
+                                  const WalkingDistance& rows, const WalkingDistance& cols,
+                                  uint32_t& rowPattern, uint32_t& colPattern) {
+    // counts[line * N + goal line]: tiles of each line, by the line they belong on
+    uint8_t rowCounts[Board<N>::CELLS] = {};
+    uint8_t colCounts[Board<N>::CELLS] = {};
+    int blankRow = 0;
+    int blankCol = 0;
+    for (int i = 0; i < Board<N>::CELLS; i++) {
+        uint8_t value = state.get(i);
+        if (value == 0) {
+            blankRow = Board<N>::ROW[i];
+            blankCol = Board<N>::COL[i];
+            continue;
+        }
+        rowCounts[Board<N>::ROW[i] * N + goalLookup.row[value]]++;
+        colCounts[Board<N>::COL[i] * N + goalLookup.col[value]]++;
+    }
+    rowPattern = rows.find(rowCounts, blankRow);
+    colPattern = cols.find(colCounts, blankCol);
+    return rows.distance(rowPattern) + cols.distance(colPattern);
+}
+
+template <int N>
+int Heuristic<N>::evaluate(const State<N>& state, HeuristicCache<N>& cache) const {
+    int distance = 0;
+    for (int i = 0; i < Board<N>::CELLS; i++) {
+        uint8_t value = state.get(i);
+        if (value != 0) {
+            distance += tileDistance(value, i);
+        }
+    }
+    cache.distance = static_cast<uint16_t>(distance);
+    cache.conflicts = 0;
+    cache.lineConflicts.fill(0);
+    cache.patternCosts.fill(0);
+    cache.rowPattern = 0;
+    cache.colPattern = 0;
+    
+    int walking = 0;
+    if (_rowWalking) {
+        walking = walkingPatterns(state, _goalLookup, *_rowWalking, *_colWalking,
+                                  cache.rowPattern, cache.colPattern);
+        if (_heuristic == 7) {
+            return walking;
+        }
+    }
+    
+    if (_patterns) {
+        uint8_t cellOf[Board<N>::CELLS];
+        locateTiles(state, cellOf);
+        int total = 0;
+        for (int group = 0; group < _patterns->getGroupCount(); group++) {
+            cache.patternCosts[group] = static_cast<uint8_t>(_patterns->groupCost(group, cellOf));
+            total += cache.patternCosts[group];
+        }
+        return total;
+    }
+    
+    if (_heuristic == 3 || _heuristic == 8) {
+        for (int line = 0; line < N; line++) {
+            cache.lineConflicts[line] = static_cast<uint8_t>(rowConflicts(state, _goalLookup, line));
+            cache.lineConflicts[N + line] = static_cast<uint8_t>(colConflicts(state, _goalLookup, line));
+            cache.conflicts += cache.lineConflicts[line] + cache.lineConflicts[N + line];
+        }
+        return std::max(walking, cache.distance + (cache.conflicts * 2));
+    }
+    return cache.distance;
+}
+
+template <int N>
+int Heuristic<N>::evaluateMove(const State<N>& child, int zeroPos, int move,
+                               const HeuristicCache<N>& parent, HeuristicCache<N>& cache) const {
+    // The blank went from zeroPos to tilePos, so the tile slid the opposite way
+    int tilePos = Board<N>::NEIGHBORS[zeroPos][move];
+    uint8_t tile = child.get(zeroPos);
+    cache = parent;
+    cache.distance = static_cast<uint16_t>(parent.distance + _delta[tile][tilePos][move ^ 1]);
+    
+    int walking = 0;
+    if (_rowWalking) {
+        // The blank moved to tilePos's line and the tile to the blank's old
+        // one: only the pattern of that orientation follows one edge
+        if (move == MOVE_UP || move == MOVE_DOWN) {
+            cache.rowPattern = _rowWalking->next(parent.rowPattern, move == MOVE_DOWN,
+                                                 _goalLookup.row[tile]);
+        } else {
+            cache.colPattern = _colWalking->next(parent.colPattern, move == MOVE_RIGHT,
+                                                 _goalLookup.col[tile]);
+        }
+        walking = _rowWalking->distance(cache.rowPattern) + _colWalking->distance(cache.colPattern);
+        if (_heuristic == 7) {
+            return walking;
+        }
+    }
+    
+    if (_patterns) {
+        // Only the moved tile's group changes cost: for every other group the
+        // blank just stepped between two of its free cells, which is free
+        uint8_t cellOf[Board<N>::CELLS];
+        locateTiles(child, cellOf);
+        int group = _patterns->getGroup(tile);
+        cache.patternCosts[group] = static_cast<uint8_t>(
+            _patterns->groupCostAfterMove(group, cellOf, parent.patternCosts[group]));
+        int total = 0;
+        for (int g = 0; g < _patterns->getGroupCount(); g++) {
+            total += cache.patternCosts[g];
+        }
+        return total;
+    }
+    
+    if (_heuristic == 3 || _heuristic == 8) {
+        // A vertical slide only reorders the two rows involved (the column just
+        // swaps the tile with the blank); a horizontal one, the two columns
+        int first;
+        int second;
+        int lineFirst;
+        int lineSecond;
+        if (move == MOVE_UP || move == MOVE_DOWN) {
+            first = Board<N>::ROW[zeroPos];
+            second = Board<N>::ROW[tilePos];
+            lineFirst = rowConflicts(child, _goalLookup, first);
+            lineSecond = rowConflicts(child, _goalLookup, second);
+        } else {
+            first = N + Board<N>::COL[zeroPos];
+            second = N + Board<N>::COL[tilePos];
+            lineFirst = colConflicts(child, _goalLookup, first - N);
+            lineSecond = colConflicts(child, _goalLookup, second - N);
+        }
+        cache.conflicts = static_cast<uint16_t>(parent.conflicts
+            - parent.lineConflicts[first] - parent.lineConflicts[second]
+            + lineFirst + lineSecond);
+        cache.lineConflicts[first] = static_cast<uint8_t>(lineFirst);
+        cache.lineConflicts[second] = static_cast<uint8_t>(lineSecond);
+        return std::max(walking, cache.distance + (cache.conflicts * 2));
+    }
+    return cache.distance;
+}
+
+template <int N>
+int Heuristic<N>::moveDelta(uint8_t tile, int zeroPos, int move) const {
+    // Same lookup as evaluateMove: the tile slides opposite to the blank
+    return _delta[tile][Board<N>::NEIGHBORS[zeroPos][move]][move ^ 1];
+}
+
+template <int N>
+bool Heuristic<N>::isTileSum() const {
+    // evaluate() returns cache.distance unless one of these adds to it
+    return !_rowWalking && !_patterns && _heuristic != 3 && _heuristic != 8;
+}
+
+template <int N>
+int Heuristic<N>::manhattanDistance(const State<N>& state, const GoalLookup<N>& goalLookup) {
     // Calculate Manhattan distance for each tile using pre-computed goal positions
     // f(n) = g(n) + h(n)
     // g(n) = cost from start to current node
     // h(n) = sum(abs(currentRow - goalRow) + abs(currentCol - goalCol))
     
     int distance = 0;
-    for (int i = 0; i < size * size; i++) {
-        uint8_t value = state[i];
+    for (int i = 0; i < Board<N>::CELLS; i++) {
+        uint8_t value = state.get(i);
         if (value != 0) {
-            int currentRow = i / size;
-            int currentCol = i % size;
+            int currentRow = Board<N>::ROW[i];
+            int currentCol = Board<N>::COL[i];
             int goalRow = goalLookup.row[value];
             int goalCol = goalLookup.col[value];
             
@@ -55,8 +310,8 @@ int Heuristic::manhattanDistance(const std::vector<uint8_t>& state,
     return distance;
 }
 
-int Heuristic::hammingDistance(const std::vector<uint8_t>& state, 
-                               const GoalLookup& goalLookup, int size) {
+template <int N>
+int Heuristic<N>::hammingDistance(const State<N>& state, const GoalLookup<N>& goalLookup) {
     // Count misplaced tiles using pre-computed goal positions
     
     // f(n) = g(n) + h(n)
@@ -64,8 +319,8 @@ int Heuristic::hammingDistance(const std::vector<uint8_t>& state,
     // h(n) = sum(misplaced tiles)
     
     int distance = 0;
-    for (int i = 0; i < size * size; i++) {
-        uint8_t value = state[i];
+    for (int i = 0; i < Board<N>::CELLS; i++) {
+        uint8_t value = state.get(i);
         if (value != 0 && goalLookup.position[value] != i) {
             distance++;
         }
@@ -74,78 +329,90 @@ int Heuristic::hammingDistance(const std::vector<uint8_t>& state,
     return distance;
 }
 
-int Heuristic::linearConflict(const std::vector<uint8_t>& state, 
-                              const GoalLookup& goalLookup, int size) {
+template <int N>
+int Heuristic<N>::linearConflict(const State<N>& state, const GoalLookup<N>& goalLookup) {
     // Linear Conflict = Manhattan Distance + (Number of conflicts * 2)
     
     // f(n) = g(n) + h(n)
     // g(n) = cost from start to current node
     // h(n) = Manhattan distance + (Number of conflicts * 2)
     
-    int distance = manhattanDistance(state, goalLookup, size);
+    return manhattanDistance(state, goalLookup) + (linearConflictCount(state, goalLookup) * 2);
+}
+
+template <int N>
+int Heuristic<N>::linearConflictCount(const State<N>& state, const GoalLookup<N>& goalLookup) {
+    // Pairs of tiles in their goal row (or column) but in reversed order
     int conflicts = 0;
-    
-    // Check for row conflicts
-    for (int row = 0; row < size; row++) {
-        for (int i = 0; i < size; i++) {
-            int posI = row * size + i;
-            uint8_t tileI = state[posI];
+    for (int line = 0; line < N; line++) {
+        conflicts += rowConflicts(state, goalLookup, line);
+        conflicts += colConflicts(state, goalLookup, line);
+    }
+    return conflicts;
+}
+
+template <int N>
+int Heuristic<N>::rowConflicts(const State<N>& state, const GoalLookup<N>& goalLookup, int row) {
+    int conflicts = 0;
+    for (int i = 0; i < N; i++) {
+        int posI = row * N + i;
+        uint8_t tileI = state.get(posI);
+        
+        if (tileI == 0) continue;
+        
+        // Only check tiles that are in their goal row
+        if (goalLookup.row[tileI] != row) continue;
+        
+        for (int j = i + 1; j < N; j++) {
+            int posJ = row * N + j;
+            uint8_t tileJ = state.get(posJ);
             
-            if (tileI == 0) continue;
+            if (tileJ == 0) continue;
             
             // Only check tiles that are in their goal row
-            if (goalLookup.row[tileI] != row) continue;
+            if (goalLookup.row[tileJ] != row) continue;
             
-            for (int j = i + 1; j < size; j++) {
-                int posJ = row * size + j;
-                uint8_t tileJ = state[posJ];
-                
-                if (tileJ == 0) continue;
-                
-                // Only check tiles that are in their goal row
-                if (goalLookup.row[tileJ] != row) continue;
-                
-                // If tiles are in reversed order relative to goal
-                if (goalLookup.col[tileI] > goalLookup.col[tileJ]) {
-                    conflicts++;
-                }
+            // If tiles are in reversed order relative to goal
+            if (goalLookup.col[tileI] > goalLookup.col[tileJ]) {
+                conflicts++;
             }
         }
     }
-    
-    // Check for column conflicts
-    for (int col = 0; col < size; col++) {
-        for (int i = 0; i < size; i++) {
-            int posI = i * size + col;
-            uint8_t tileI = state[posI];
+    return conflicts;
+}
+
+template <int N>
+int Heuristic<N>::colConflicts(const State<N>& state, const GoalLookup<N>& goalLookup, int col) {
+    int conflicts = 0;
+    for (int i = 0; i < N; i++) {
+        int posI = i * N + col;
+        uint8_t tileI = state.get(posI);
+        
+        if (tileI == 0) continue;
+        
+        // Only check tiles that are in their goal column
+        if (goalLookup.col[tileI] != col) continue;
+        
+        for (int j = i + 1; j < N; j++) {
+            int posJ = j * N + col;
+            uint8_t tileJ = state.get(posJ);
             
-            if (tileI == 0) continue;
+            if (tileJ == 0) continue;
             
             // Only check tiles that are in their goal column
-            if (goalLookup.col[tileI] != col) continue;
+            if (goalLookup.col[tileJ] != col) continue;
             
-            for (int j = i + 1; j < size; j++) {
-                int posJ = j * size + col;
-                uint8_t tileJ = state[posJ];
-                
-                if (tileJ == 0) continue;
-                
-                // Only check tiles that are in their goal column
-                if (goalLookup.col[tileJ] != col) continue;
-                
-                // If tiles are in reversed order relative to goal
-                if (goalLookup.row[tileI] > goalLookup.row[tileJ]) {
-                    conflicts++;
-                }
+            // If tiles are in reversed order relative to goal
+            if (goalLookup.row[tileI] > goalLookup.row[tileJ]) {
+                conflicts++;
             }
         }
     }
-    
-    return distance + (conflicts * 2);
+    return conflicts;
 }
 
-int Heuristic::uninformedSearch(const std::vector<uint8_t>& state, 
-                                const GoalLookup& goalLookup, int size) {
+template <int N>
+int Heuristic<N>::uninformedSearch(const State<N>& state, const GoalLookup<N>& goalLookup) {
     // Uninformed search = Dijkstra's algorithm = Uniform Cost Search = UCS
     // No heuristic, always returns 0
     // f(n) = g(n)
@@ -153,26 +420,99 @@ int Heuristic::uninformedSearch(const std::vector<uint8_t>& state,
     
     (void)state;
     (void)goalLookup;
-    (void)size;
     return 0;
 }
 
 
-int Heuristic::getHeuristicValue(const std::vector<uint8_t>& state,
-                                 const GoalLookup& goalLookup,
-                                 int size, int heuristic) {
+template <int N>
+int Heuristic<N>::patternDatabase(const State<N>& state, const GoalLookup<N>& goalLookup, int heuristic) {
+    // Additive disjoint pattern databases (4x4 only, Linear Conflict elsewhere)
+    if (N != PatternDatabase::SIZE) {
+        return linearConflict(state, goalLookup);
+    }
+    
+    std::vector<uint8_t> goal(Board<N>::CELLS, 0);
+    for (int tile = 1; tile < Board<N>::CELLS; tile++) {
+        goal[goalLookup.position[tile]] = static_cast<uint8_t>(tile);
+    }
+    
+    uint8_t cellOf[Board<N>::CELLS];
+    locateTiles(state, cellOf);
+    return PatternDatabase::get(goal, heuristic).totalCost(cellOf);
+}
+
+template <int N>
+int Heuristic<N>::walkingDistance(const State<N>& state, const GoalLookup<N>& goalLookup) {
+    // Walking distance (up to 4x4, Linear Conflict elsewhere)
+    if (!WalkingDistance::isSupported(N)) {
+        return linearConflict(state, goalLookup);
+    }
+    
+    // The goal's blank is on the one cell no tile belongs to
+    int blank = Board<N>::CELLS * (Board<N>::CELLS - 1) / 2;
+    for (int tile = 1; tile < Board<N>::CELLS; tile++) {
+        blank -= goalLookup.position[tile];
+    }
+    
+    uint32_t rowPattern;
+    uint32_t colPattern;
+    return walkingPatterns(state, goalLookup,
+                           WalkingDistance::get(N, Board<N>::ROW[blank]),
+                           WalkingDistance::get(N, Board<N>::COL[blank]),
+                           rowPattern, colPattern);
+}
+
+template <int N>
+int Heuristic<N>::getHeuristicValue(const State<N>& state,
+                                    const GoalLookup<N>& goalLookup,
+                                    int heuristic) {
     switch (heuristic) {
         case 1:
-            return manhattanDistance(state, goalLookup, size);
+            return manhattanDistance(state, goalLookup);
         case 2:
-            return hammingDistance(state, goalLookup, size);
+            return hammingDistance(state, goalLookup);
         case 3:
-            return linearConflict(state, goalLookup, size);
+            return linearConflict(state, goalLookup);
+        case 4:
+            return uninformedSearch(state, goalLookup);
+        case 5:
+        case 6:
+            return patternDatabase(state, goalLookup, heuristic);
+        case 7:
+            return walkingDistance(state, goalLookup);
+        case 8:
+            return std::max(walkingDistance(state, goalLookup), linearConflict(state, goalLookup));
+        default:
+            // Unknown ids use Manhattan distance as the base heuristic
+            return manhattanDistance(state, goalLookup);
+    }
+}
+
+std::string getHeuristicName(int heuristic) {
+    switch (heuristic) {
+        case 0:
         case 4:
-            return uninformedSearch(state, goalLookup, size);
+            return "None (uninformed)";
+        case 1:
+            return "Manhattan Distance";
+        case 2:
+            return "Hamming Distance";
+        case 3:
+            return "Linear Conflict";
+        case 5:
+            return "Pattern Database 5-5-5";
+        case 6:
+            return "Pattern Database 6-6-3";
+        case 7:
+            return "Walking Distance";
+        case 8:
+            return "Walking Distance + Linear Conflict";
         default:
-            // For Greedy (5), Weighted A* (6), and Beam Search (7),
-            // use Manhattan distance as the base heuristic
-            return manhattanDistance(state, goalLookup, size);
+            return "Unknown";
     }
 }
+
+#define INSTANTIATE_HEURISTIC(N) \
+    template struct GoalLookup<N>; \
+    template class Heuristic<N>;
+NPUZZLE_FOR_EACH_SIZE(INSTANTIATE_HEURISTIC)
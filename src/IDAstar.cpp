@@ -0,0 +1,410 @@
+#include "../includes/IDAstar.hpp"
+#include "../includes/Heuristic.hpp"
+#include "../includes/SolutionLogger.hpp"
+#include <iostream>
+#include <chrono>
+#include <iomanip>
+#include <algorithm>
+#include <climits>
+#include <thread>
+
+IDAstar::IDAstar() {}
+
+IDAstar::~IDAstar() {}
+
+IDAstar::IDAstar(const IDAstar& other) {
+    (void)other;
+}
+
+IDAstar& IDAstar::operator=(const IDAstar& other) {
+    (void)other;
+    return *this;
+}
+
+template <int N>
+int IDAstar::search(SearchContext<N>& context, int g, int h, int bound) {
+    int f = g + h;
+    if (f > bound) {
+        return f;
+    }
+    if (context.state == *context.goal) {
+        return FOUND;
+    }
+
+    context.expanded++;
+    context.maxDepth = std::max(context.maxDepth, g);
+
+    // Another worker found the goal or ran out of time
+    if (context.stop->load(std::memory_order_relaxed)) {
+        return ABORTED;
+    }
+
+    // Timeout check - cheap enough only every few thousand expansions
+    if (context.maxTimeSeconds > 0 && context.expanded % TIME_CHECK_INTERVAL == 0) {
+        double elapsed = std::chrono::duration<double>(
+            std::chrono::high_resolution_clock::now() - context.startTime).count();
+        if (elapsed > context.maxTimeSeconds) {
+            context.timedOut = true;
+            return ABORTED;
+        }
+    }
+
+    if (static_cast<int>(context.caches.size()) <= g + 1) {
+        context.caches.resize(g + 2);
+    }
+
+    int nextBound = INT_MAX;
+    int zeroPos = context.zeroPos;
+    for (int move = 0; move < MOVE_COUNT; move++) {
+        // Never undo the previous move
+        if (!context.path.empty() && move == (context.path.back() ^ 1)) {
+            continue;
+        }
+        int tilePos = Board<N>::NEIGHBORS[zeroPos][move];
+        if (tilePos == Board<N>::NO_CELL) {
+            continue;
+        }
+
+        // Slide in place, recurse, slide back
+        context.state.slide(zeroPos, tilePos);
+        int childH = context.estimator->evaluateMove(context.state, zeroPos, move,
+                                                     context.caches[g], context.caches[g + 1]);
+        context.zeroPos = tilePos;
+        context.path.push_back(static_cast<uint8_t>(move));
+
+        int result = search(context, g + 1, childH, bound);
+        if (result == FOUND || result == ABORTED) {
+            return result;
+        }
+
+        context.path.pop_back();
+        context.zeroPos = zeroPos;
+        context.state.slide(tilePos, zeroPos);
+        nextBound = std::min(nextBound, result);
+    }
+    return nextBound;
+}
+
+template <int N>
+bool IDAstar::split(SearchContext<N>& root, int initialH, size_t minItems,
+                    std::vector<WorkItem<N>>& items) {
+    items.clear();
+    items.push_back({root.state, root.zeroPos, 0, initialH, {}, root.caches[0]});
+
+    // Level by level: the tree has every path of each length, so the first
+    // goal met is at the optimal depth
+    std::vector<WorkItem<N>> level;
+    while (items.size() < minItems) {
+        level.clear();
+        for (const WorkItem<N>& item : items) {
+            root.expanded++;
+            for (int move = 0; move < MOVE_COUNT; move++) {
+                if (!item.path.empty() && move == (item.path.back() ^ 1)) {
+                    continue;
+                }
+                int tilePos = Board<N>::NEIGHBORS[item.zeroPos][move];
+                if (tilePos == Board<N>::NO_CELL) {
+                    continue;
+                }
+
+                WorkItem<N> child = {item.state, tilePos, item.g + 1, 0, item.path, item.cache};
+                child.state.slide(item.zeroPos, tilePos);
+                child.h = root.estimator->evaluateMove(child.state, item.zeroPos, move,
+                                                       item.cache, child.cache);
+                child.path.push_back(static_cast<uint8_t>(move));
+                if (child.state == *root.goal) {
+                    root.path = child.path;
+                    return true;
+                }
+                level.push_back(child);
+            }
+        }
+        items.swap(level);
+        root.maxDepth = items.front().g;
+    }
+    return false;
+}
+
+bool IDAstar::takeItem(std::vector<WorkQueue>& queues, size_t worker, size_t& index) {
+    {
+        std::lock_guard<std::mutex> lock(queues[worker].mutex);
+        if (!queues[worker].items.empty()) {
+            index = queues[worker].items.front();
+            queues[worker].items.pop_front();
+            return true;
+        }
+    }
+
+    // Own queue drained - steal from the others, nearest first
+    for (size_t offset = 1; offset < queues.size(); offset++) {
+        WorkQueue& victim = queues[(worker + offset) % queues.size()];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.items.empty()) {
+            index = victim.items.back();
+            victim.items.pop_back();
+            return true;
+        }
+    }
+    return false;
+}
+
+template <int N>
+int IDAstar::searchParallel(SearchContext<N>& root, const std::vector<WorkItem<N>>& items,
+                            std::vector<SearchContext<N>>& workers, int bound) {
+    // Neighbouring items share most of their path: dealing them out round
+    // robin spreads the expensive parts of the tree over every worker
+    std::vector<WorkQueue> queues(workers.size());
+    for (size_t i = 0; i < items.size(); i++) {
+        queues[i % queues.size()].items.push_back(i);
+    }
+
+    std::atomic<bool> stop(false);
+    std::mutex resultMutex;
+    int nextBound = INT_MAX;
+    bool found = false;
+    bool timedOut = false;
+
+    auto work = [&](size_t worker) {
+        SearchContext<N>& context = workers[worker];
+        context.stop = &stop;
+        int localBound = INT_MAX;
+        size_t index;
+
+        while (!stop.load(std::memory_order_relaxed) && takeItem(queues, worker, index)) {
+            const WorkItem<N>& item = items[index];
+            context.state = item.state;
+            context.zeroPos = item.zeroPos;
+            context.path = item.path;
+            if (static_cast<int>(context.caches.size()) <= item.g) {
+                context.caches.resize(item.g + 1);
+            }
+            context.caches[item.g] = item.cache;
+
+            int result = search(context, item.g, item.h, bound);
+            if (result == FOUND || (result == ABORTED && context.timedOut)) {
+                // Any goal under the bound is optimal: nothing else to prove
+                std::lock_guard<std::mutex> lock(resultMutex);
+                if (result == FOUND && !found) {
+                    found = true;
+                    root.path = context.path;
+                }
+                timedOut = timedOut || result == ABORTED;
+                stop.store(true, std::memory_order_relaxed);
+                break;
+            }
+            if (result == ABORTED) {
+                break;
+            }
+            localBound = std::min(localBound, result);
+        }
+
+        std::lock_guard<std::mutex> lock(resultMutex);
+        nextBound = std::min(nextBound, localBound);
+    };
+
+    std::vector<std::thread> pool;
+    for (size_t worker = 1; worker < workers.size(); worker++) {
+        pool.emplace_back(work, worker);
+    }
+    work(0);
+    for (std::thread& thread : pool) {
+        thread.join();
+    }
+
+    if (found) {
+        return FOUND;
+    }
+    return timedOut ? ABORTED : nextBound;
+}
+
+template <int N>
+AStarResult IDAstar::solve(Puzzle& puzzle, int heuristic, bool silent, double maxTimeSeconds,
+                           int threads) {
+    auto startTime = std::chrono::high_resolution_clock::now();
+
+    // Get initial state and goal
+    const std::vector<uint8_t>& initialState = puzzle.getGrid();
+    const std::vector<uint8_t>& goal = puzzle.getGoal();
+
+    // Packed search representation of the start and goal boards
+    const State<N> initial(initialState);
+    const State<N> goalState(goal);
+
+    // Display time limit (set by Game class); memory is bounded by the depth
+    if (!silent) {
+        std::cout << "\n[Memory Safety] IDA* keeps only the current path in memory\n";
+        std::cout << "[Time Safety] Max execution time: " << maxTimeSeconds << " seconds\n";
+        if (threads > 1) {
+            std::cout << "[Threads] " << threads << " workers with work stealing\n";
+        }
+    }
+
+    // Check if already at goal
+    if (initial == goalState) {
+        if (!silent) {
+            std::cout << "\nPuzzle is already solved!\n";
+        }
+        auto endTime = std::chrono::high_resolution_clock::now();
+        double duration = std::chrono::duration<double>(endTime - startTime).count();
+
+        return {true, 0, 0, 0, duration, heuristic, "", 8, "IDA*", false, "", 1.0};
+    }
+
+    // Check if puzzle is solvable
+    if (!puzzle.isSolvable()) {
+        if (!silent) {
+            std::cout << "\nPuzzle is unsolvable!\n";
+
+            // Log failure to file
+            std::string heuristicName = getHeuristicName(heuristic);
+
+            SolutionLogger::logFailure(
+                "IDA*", heuristicName, initialState, goal, N,
+                "Puzzle is unsolvable", 0, 0, 0
+            );
+        }
+        auto endTime = std::chrono::high_resolution_clock::now();
+        double duration = std::chrono::duration<double>(endTime - startTime).count();
+
+        return {false, 0, 0, 0, duration, heuristic, "", 8, "IDA*", false, "Puzzle is unsolvable", 1.0};
+    }
+
+    // Goal lookup and per-move delta tables, built once per goal and heuristic
+    const Heuristic<N>& estimator = Heuristic<N>::get(goal, heuristic);
+
+    // Find initial blank position
+    int initialZeroPos = 0;
+    for (size_t i = 0; i < initialState.size(); i++) {
+        if (initialState[i] == 0) {
+            initialZeroPos = static_cast<int>(i);
+            break;
+        }
+    }
+
+    SearchContext<N> context;
+    context.state = initial;
+    context.zeroPos = initialZeroPos;
+    context.goal = &goalState;
+    context.estimator = &estimator;
+    context.caches.resize(1);
+    context.expanded = 0;
+    context.maxDepth = 0;
+    context.startTime = startTime;
+    context.maxTimeSeconds = maxTimeSeconds;
+    std::atomic<bool> neverStop(false);
+    context.stop = &neverStop;
+    context.timedOut = false;
+
+    // Calculate initial heuristic; it is the first bound
+    int initialH = estimator.evaluate(initial, context.caches[0]);
+    int bound = initialH;
+    int iterations = 0;
+    int result = INT_MAX;
+
+    // Workers keep their caches and node counts from one pass to the next
+    std::vector<WorkItem<N>> items;
+    std::vector<SearchContext<N>> workers;
+    if (threads > 1) {
+        if (split(context, initialH, static_cast<size_t>(threads) * WORK_ITEMS_PER_THREAD, items)) {
+            result = FOUND;
+        }
+        workers.assign(threads, context);
+        for (SearchContext<N>& worker : workers) {
+            worker.expanded = 0;
+        }
+    }
+
+    while (result != FOUND) {
+        iterations++;
+        if (threads > 1) {
+            result = searchParallel(context, items, workers, bound);
+        } else {
+            result = search(context, 0, initialH, bound);
+        }
+        if (result == FOUND || result == ABORTED || result == INT_MAX) {
+            break;
+        }
+        bound = result;
+    }
+
+    // Space: the boards on the deepest path explored, per worker, plus the split
+    std::vector<long long> threadNodes;
+    long long expanded = context.expanded;
+    int maxStatesEnqueued = context.maxDepth + 1;
+    if (threads > 1) {
+        maxStatesEnqueued = static_cast<int>(items.size());
+        for (const SearchContext<N>& worker : workers) {
+            threadNodes.push_back(worker.expanded);
+            expanded += worker.expanded;
+            maxStatesEnqueued += worker.maxDepth + 1;
+        }
+    }
+
+    auto endTime = std::chrono::high_resolution_clock::now();
+    double duration = std::chrono::duration<double>(endTime - startTime).count();
+    int totalSetOpened = static_cast<int>(std::min<long long>(expanded, INT_MAX));
+
+    if (result == FOUND) {
+        int moves = static_cast<int>(context.path.size());
+
+        if (!silent) {
+            std::cout << "\n" << std::string(50, '=') << "\n";
+            std::cout << "Solution found!\n";
+            std::cout << std::string(50, '=') << "\n";
+            std::cout << "Total moves required: " << moves << "\n";
+            std::cout << "Total states opened (time complexity): " << totalSetOpened << "\n";
+            std::cout << "Maximum states in memory (space complexity): " << maxStatesEnqueued << "\n";
+            std::cout << "Iterations (f bounds searched): " << iterations << "\n";
+            for (size_t i = 0; i < threadNodes.size(); i++) {
+                std::cout << "  Thread " << i << " states opened: " << threadNodes[i] << "\n";
+            }
+            std::cout << "Execution time: " << std::fixed << std::setprecision(4)
+                     << duration << "s\n";
+            std::cout << std::string(50, '=') << "\n";
+
+            // Log solution to file
+            std::string heuristicName = getHeuristicName(heuristic);
+
+            SolutionLogger::logSolution(
+                "IDA*", heuristicName, initialState, goal, N,
+                context.path, moves, totalSetOpened, maxStatesEnqueued, duration
+            );
+        }
+
+        return {true, moves, totalSetOpened, maxStatesEnqueued, duration, heuristic, "", 8, "IDA*", false, "", 1.0,
+                threadNodes};
+    }
+
+    std::string reason = (result == ABORTED) ? "Timeout reached" : "No solution found";
+    if (!silent) {
+        std::cout << "\n" << std::string(50, '=') << "\n";
+        if (result == ABORTED) {
+            std::cout << "⏱️  TIMEOUT REACHED!\n";
+        } else {
+            std::cout << "No solution found! Puzzle may be unsolvable.\n";
+        }
+        std::cout << std::string(50, '=') << "\n";
+        std::cout << "Explored " << totalSetOpened << " states (last f bound: " << bound << ")\n";
+        std::cout << "Maximum states in memory: " << maxStatesEnqueued << "\n";
+        for (size_t i = 0; i < threadNodes.size(); i++) {
+            std::cout << "  Thread " << i << " states opened: " << threadNodes[i] << "\n";
+        }
+        std::cout << "Execution time: " << std::fixed << std::setprecision(4)
+                 << duration << "s\n";
+
+        // Log failure to file
+        std::string heuristicName = getHeuristicName(heuristic);
+
+        SolutionLogger::logFailure(
+            "IDA*", heuristicName, initialState, goal, N,
+            reason, totalSetOpened, maxStatesEnqueued, duration
+        );
+    }
+
+    return {false, 0, totalSetOpened, maxStatesEnqueued, duration, heuristic, "",
+            8, "IDA*", false, reason, 1.0, threadNodes};
+}
+
+#define INSTANTIATE_IDASTAR(N) \
+    template AStarResult IDAstar::solve<N>(Puzzle&, int, bool, double, int);
+NPUZZLE_FOR_EACH_SIZE(INSTANTIATE_IDASTAR)
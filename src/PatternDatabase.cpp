@@ -0,0 +1,602 @@
+#include "../includes/PatternDatabase.hpp"
+#include "../includes/Board.hpp"
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <sstream>
+#include <chrono>
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <cstdio>
+#include <map>
+#include <mutex>
+#include <tuple>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+PatternDatabase::Encoding PatternDatabase::_encoding = PatternDatabase::ENCODING_NIBBLE;
+
+PatternDatabase::PatternDatabase()
+    : _groups(), _groupOf(), _storageEncoding(ENCODING_BYTE), _distance() {
+    _groupOf.fill(-1);
+}
+
+PatternDatabase::PatternDatabase(const std::vector<uint8_t>& goal,
+                                 const std::vector<std::vector<uint8_t>>& groups,
+                                 Encoding encoding)
+    : _groups(), _groupOf(), _storageEncoding(encoding), _distance() {
+    _groupOf.fill(-1);
+    buildDistances(goal);
+    for (size_t g = 0; g < groups.size(); g++) {
+        Group group;
+        group.tiles = groups[g];
+        group.costs = nullptr;
+        for (uint8_t tile : group.tiles) {
+            _groupOf[tile] = static_cast<int8_t>(g);
+        }
+        build(group, goal);
+        _groups.push_back(group);
+    }
+}
+
+PatternDatabase::~PatternDatabase() {}
+
+PatternDatabase::PatternDatabase(const PatternDatabase& other)
+    : _groups(other._groups), _groupOf(other._groupOf),
+      _storageEncoding(other._storageEncoding), _distance(other._distance) {}
+
+PatternDatabase& PatternDatabase::operator=(const PatternDatabase& other) {
+    if (this != &other) {
+        _groups = other._groups;
+        _groupOf = other._groupOf;
+        _storageEncoding = other._storageEncoding;
+        _distance = other._distance;
+    }
+    return *this;
+}
+
+bool PatternDatabase::isPatternHeuristic(int heuristic) {
+    return heuristic == 5 || heuristic == 6;
+}
+
+void PatternDatabase::setEncoding(Encoding encoding) {
+    _encoding = encoding;
+}
+
+PatternDatabase::Encoding PatternDatabase::getEncoding() {
+    return _encoding;
+}
+
+const char* PatternDatabase::getEncodingName(Encoding encoding) {
+    switch (encoding) {
+        case ENCODING_BYTE: return "byte";
+        case ENCODING_NIBBLE: return "nibble";
+        case ENCODING_MOD3: return "mod3";
+        case ENCODING_MIN_BLANK: return "min-blank";
+        default: return "unknown";
+    }
+}
+
+bool PatternDatabase::parseEncoding(const std::string& name, Encoding& encoding) {
+    for (int e = 0; e < ENCODING_COUNT; e++) {
+        if (name == getEncodingName(static_cast<Encoding>(e))) {
+            encoding = static_cast<Encoding>(e);
+            return true;
+        }
+    }
+    return false;
+}
+
+std::vector<std::vector<uint8_t>> PatternDatabase::partitionFor(int heuristic) {
+    // Groups are spatially compact on the snail goal:
+    //   1  2  3  4
+    //  12 13 14  5
+    //  11  _ 15  6
+    //  10  9  8  7
+    if (heuristic == 5) {
+        return {{1, 2, 11, 12, 13}, {3, 4, 5, 6, 14}, {7, 8, 9, 10, 15}};
+    }
+    return {{1, 2, 10, 11, 12, 13}, {3, 4, 5, 6, 14, 15}, {7, 8, 9}};
+}
+
+const PatternDatabase& PatternDatabase::get(const std::vector<uint8_t>& goal, int heuristic) {
+    static std::map<std::tuple<std::vector<uint8_t>, int, int>, PatternDatabase> databases;
+    static std::mutex databasesMutex;
+
+    std::lock_guard<std::mutex> lock(databasesMutex);
+    Encoding encoding = _encoding;
+    std::tuple<std::vector<uint8_t>, int, int> key(goal, heuristic, encoding);
+    auto it = databases.find(key);
+    if (it != databases.end()) {
+        return it->second;
+    }
+
+    std::vector<std::vector<uint8_t>> groups = partitionFor(heuristic);
+    PatternDatabase& database = databases[key];
+    if (database.load(filePath(goal, heuristic, encoding), goal, groups, encoding)) {
+        return database;
+    }
+
+    std::cout << "\n[Pattern Database] Building " << groups.size() << " "
+              << getEncodingName(encoding)
+              << " tables for this goal (run 'make pdb' to keep them on disk)...";
+    std::cout.flush();
+    auto startTime = std::chrono::high_resolution_clock::now();
+
+    database = PatternDatabase(goal, groups, encoding);
+
+    double duration = std::chrono::duration<double>(
+        std::chrono::high_resolution_clock::now() - startTime).count();
+    std::cout << " done (" << std::fixed << std::setprecision(2) << duration << "s, "
+              << database.memoryUsage() / (1024 * 1024) << " MB)\n";
+    return database;
+}
+
+bool PatternDatabase::generateFiles(const std::vector<uint8_t>& goal) {
+    struct stat st;
+    if (stat("pdb", &st) != 0) {
+        mkdir("pdb", 0755);
+    }
+
+    const int heuristics[] = {5, 6};
+    for (int heuristic : heuristics) {
+        std::string path = filePath(goal, heuristic, _encoding);
+        std::cout << "[Pattern Database] Generating " << path << "...";
+        std::cout.flush();
+        auto startTime = std::chrono::high_resolution_clock::now();
+
+        PatternDatabase database(goal, partitionFor(heuristic), _encoding);
+        if (!database.save(path, goal)) {
+            std::cout << " failed\n";
+            return false;
+        }
+
+        double duration = std::chrono::duration<double>(
+            std::chrono::high_resolution_clock::now() - startTime).count();
+        std::cout << " done (" << std::fixed << std::setprecision(2) << duration << "s, "
+                  << database.memoryUsage() / (1024 * 1024) << " MB)\n";
+    }
+    return true;
+}
+
+std::string PatternDatabase::filePath(const std::vector<uint8_t>& goal, int heuristic,
+                                      Encoding encoding) {
+    std::ostringstream path;
+    path << "pdb/" << SIZE << "x" << SIZE << "-" << (heuristic == 5 ? "5-5-5" : "6-6-3")
+         << "-" << getEncodingName(encoding) << "-";
+    for (uint8_t tile : goal) {
+        path << std::hex << static_cast<int>(tile);
+    }
+    path << ".pdb";
+    return path.str();
+}
+
+PatternDatabase::FileHeader PatternDatabase::makeHeader(const std::vector<uint8_t>& goal,
+                                                        const std::vector<std::vector<uint8_t>>& groups,
+                                                        Encoding encoding) {
+    // Zeroed first so padding and unused slots compare equal byte for byte
+    FileHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, "NPDB", 4);
+    header.version = FILE_VERSION;
+    header.boardSize = SIZE;
+    header.encoding = static_cast<uint32_t>(encoding);
+    header.groupCount = static_cast<uint32_t>(groups.size());
+    for (int i = 0; i < CELLS; i++) {
+        header.goal[i] = goal[i];
+    }
+    for (size_t g = 0; g < groups.size() && g < MAX_GROUPS; g++) {
+        header.groupSizes[g] = static_cast<uint8_t>(groups[g].size());
+        for (size_t t = 0; t < groups[g].size(); t++) {
+            header.tiles[g][t] = groups[g][t];
+        }
+    }
+    return header;
+}
+
+bool PatternDatabase::save(const std::string& path, const std::vector<uint8_t>& goal) const {
+    std::vector<std::vector<uint8_t>> groups;
+    for (const Group& group : _groups) {
+        groups.push_back(group.tiles);
+    }
+    FileHeader header = makeHeader(goal, groups, _storageEncoding);
+
+    // Written aside then renamed, so a reader never maps a half-written file
+    std::string tmpPath = path + ".tmp";
+    std::ofstream file(tmpPath, std::ios::binary | std::ios::trunc);
+    if (!file) {
+        return false;
+    }
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    for (const Group& group : _groups) {
+        file.write(reinterpret_cast<const char*>(group.costs), static_cast<std::streamsize>(
+            storageSize(static_cast<int>(group.tiles.size()), _storageEncoding)));
+    }
+    file.close();
+    if (!file) {
+        std::remove(tmpPath.c_str());
+        return false;
+    }
+    return std::rename(tmpPath.c_str(), path.c_str()) == 0;
+}
+
+bool PatternDatabase::load(const std::string& path, const std::vector<uint8_t>& goal,
+                           const std::vector<std::vector<uint8_t>>& groups, Encoding encoding) {
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) < sizeof(FileHeader)) {
+        close(fd);
+        return false;
+    }
+    size_t fileSize = static_cast<size_t>(st.st_size);
+    void* mapped = mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (mapped == MAP_FAILED) {
+        return false;
+    }
+    // Unmapped when the last group referencing it goes away
+    std::shared_ptr<const uint8_t> mapping(static_cast<const uint8_t*>(mapped),
+        [fileSize](const uint8_t* data) { munmap(const_cast<uint8_t*>(data), fileSize); });
+
+    FileHeader expected = makeHeader(goal, groups, encoding);
+    size_t expectedSize = sizeof(FileHeader);
+    for (const std::vector<uint8_t>& tiles : groups) {
+        expectedSize += storageSize(static_cast<int>(tiles.size()), encoding);
+    }
+    if (std::memcmp(mapped, &expected, sizeof(FileHeader)) != 0 || fileSize != expectedSize) {
+        return false;
+    }
+
+    std::vector<Group> loaded;
+    std::array<int8_t, CELLS> groupOf;
+    groupOf.fill(-1);
+    const uint8_t* costs = mapping.get() + sizeof(FileHeader);
+    for (size_t g = 0; g < groups.size(); g++) {
+        Group group;
+        group.tiles = groups[g];
+        group.costs = costs;
+        group.storage = mapping;
+        for (uint8_t tile : group.tiles) {
+            groupOf[tile] = static_cast<int8_t>(g);
+        }
+        costs += storageSize(static_cast<int>(group.tiles.size()), encoding);
+        loaded.push_back(group);
+    }
+    _groups.swap(loaded);
+    _groupOf = groupOf;
+    _storageEncoding = encoding;
+    buildDistances(goal);
+    return true;
+}
+
+void PatternDatabase::buildDistances(const std::vector<uint8_t>& goal) {
+    for (int home = 0; home < CELLS; home++) {
+        for (int cell = 0; cell < CELLS; cell++) {
+            _distance[goal[home]][cell] = static_cast<uint8_t>(
+                std::abs(home / SIZE - cell / SIZE) + std::abs(home % SIZE - cell % SIZE));
+        }
+    }
+}
+
+int PatternDatabase::getGroupCount() const {
+    return static_cast<int>(_groups.size());
+}
+
+int PatternDatabase::getGroup(uint8_t tile) const {
+    return _groupOf[tile];
+}
+
+PatternDatabase::Encoding PatternDatabase::getStorageEncoding() const {
+    return _storageEncoding;
+}
+
+size_t PatternDatabase::memoryUsage() const {
+    size_t bytes = 0;
+    for (const Group& group : _groups) {
+        bytes += storageSize(static_cast<int>(group.tiles.size()), _storageEncoding);
+    }
+    return bytes;
+}
+
+int PatternDatabase::groupDistance(const Group& group, const uint8_t* cells) const {
+    int distance = 0;
+    for (size_t i = 0; i < group.tiles.size(); i++) {
+        distance += _distance[group.tiles[i]][cells[i]];
+    }
+    return distance;
+}
+
+int PatternDatabase::storedValue(const Group& group, const uint8_t* cells, int blank) const {
+    const int count = static_cast<int>(group.tiles.size());
+    if (_storageEncoding == ENCODING_MIN_BLANK) {
+        return group.costs[rank(cells, count)];
+    }
+
+    // The blank is ranked as one more tile after the group's own
+    uint8_t withBlank[CELLS];
+    std::memcpy(withBlank, cells, count);
+    withBlank[count] = static_cast<uint8_t>(blank);
+    uint64_t index = rank(withBlank, count + 1);
+
+    switch (_storageEncoding) {
+        case ENCODING_NIBBLE:
+            return (group.costs[index >> 1] >> ((index & 1) * 4)) & 0xF;
+        case ENCODING_MOD3:
+            return (group.costs[index >> 2] >> ((index & 3) * 2)) & 0x3;
+        default:
+            return group.costs[index];
+    }
+}
+
+int PatternDatabase::groupCost(int group, const uint8_t* cellOf) const {
+    const Group& g = _groups[group];
+    uint8_t cells[CELLS];
+    for (size_t i = 0; i < g.tiles.size(); i++) {
+        cells[i] = cellOf[g.tiles[i]];
+    }
+
+    switch (_storageEncoding) {
+        case ENCODING_NIBBLE:
+            return groupDistance(g, cells) + 2 * storedValue(g, cells, cellOf[0]);
+        case ENCODING_MOD3:
+            return descend(g, cells, cellOf[0]);
+        default:
+            return storedValue(g, cells, cellOf[0]);
+    }
+}
+
+int PatternDatabase::groupCostAfterMove(int group, const uint8_t* cellOf, int knownCost) const {
+    if (_storageEncoding != ENCODING_MOD3) {
+        return groupCost(group, cellOf);
+    }
+
+    // One move changes a group's cost by at most one, and knownCost - 1,
+    // knownCost, knownCost + 1 all differ mod 3
+    const Group& g = _groups[group];
+    uint8_t cells[CELLS];
+    for (size_t i = 0; i < g.tiles.size(); i++) {
+        cells[i] = cellOf[g.tiles[i]];
+    }
+    int residue = storedValue(g, cells, cellOf[0]);
+    int step = (residue - knownCost % 3 + 3) % 3;
+    return step == 2 ? knownCost - 1 : knownCost + step;
+}
+
+int PatternDatabase::totalCost(const uint8_t* cellOf) const {
+    int cost = 0;
+    for (int g = 0; g < getGroupCount(); g++) {
+        cost += groupCost(g, cellOf);
+    }
+    return cost;
+}
+
+int PatternDatabase::descend(const Group& group, uint8_t* cells, int blank) const {
+    // Every position but the goal has a neighbour one move closer, the one
+    // whose residue is one less; at the goal no neighbour has it
+    const int count = static_cast<int>(group.tiles.size());
+    int residue = storedValue(group, cells, blank);
+    int cost = 0;
+    bool stepped = true;
+    while (stepped) {
+        stepped = false;
+        uint32_t occupied = 0;
+        for (int t = 0; t < count; t++) {
+            occupied |= 1u << cells[t];
+        }
+        uint32_t region = floodBlank(1u << blank, ALL_CELLS & ~occupied);
+        int wanted = (residue + 2) % 3;
+
+        for (int t = 0; t < count && !stepped; t++) {
+            int from = cells[t];
+            for (int move = 0; move < MOVE_COUNT; move++) {
+                int to = Board<SIZE>::NEIGHBORS[from][move];
+                if (to == Board<SIZE>::NO_CELL || !(region & (1u << to))) {
+                    continue;
+                }
+                cells[t] = static_cast<uint8_t>(to);
+                if (storedValue(group, cells, from) == wanted) {
+                    blank = from;
+                    residue = wanted;
+                    cost++;
+                    stepped = true;
+                    break;
+                }
+                cells[t] = static_cast<uint8_t>(from);
+            }
+        }
+    }
+    return cost;
+}
+
+uint32_t PatternDatabase::floodBlank(uint32_t region, uint32_t freeCells) {
+    // Grow the blank's region one step in every direction until it stops
+    while (true) {
+        uint32_t grown = region
+                       | (region << SIZE)
+                       | (region >> SIZE)
+                       | ((region << 1) & ~FIRST_COLUMN)
+                       | ((region >> 1) & ~LAST_COLUMN);
+        grown &= freeCells;
+        if (grown == region) {
+            return region;
+        }
+        region = grown;
+    }
+}
+
+uint64_t PatternDatabase::tableSize(int count) {
+    uint64_t size = 1;
+    for (int i = 0; i < count; i++) {
+        size *= CELLS - i;
+    }
+    return size;
+}
+
+uint64_t PatternDatabase::storageSize(int count, Encoding encoding) {
+    switch (encoding) {
+        case ENCODING_NIBBLE:
+            return (tableSize(count + 1) + 1) / 2;
+        case ENCODING_MOD3:
+            return (tableSize(count + 1) + 3) / 4;
+        case ENCODING_MIN_BLANK:
+            return tableSize(count);
+        default:
+            return tableSize(count + 1);
+    }
+}
+
+uint64_t PatternDatabase::rank(const uint8_t* cells, int count) {
+    // Mixed radix: digit i is the cell's rank among the cells still unused
+    uint64_t index = 0;
+    uint32_t used = 0;
+    for (int i = 0; i < count; i++) {
+        uint32_t cell = cells[i];
+        uint32_t digit = cell - __builtin_popcount(used & ((1u << cell) - 1));
+        index = index * (CELLS - i) + digit;
+        used |= 1u << cell;
+    }
+    return index;
+}
+
+uint64_t PatternDatabase::pack(const uint8_t* cells, int count, int regionCell) {
+    uint64_t packed = static_cast<uint64_t>(regionCell) << (4 * count);
+    for (int i = 0; i < count; i++) {
+        packed |= static_cast<uint64_t>(cells[i]) << (4 * i);
+    }
+    return packed;
+}
+
+void PatternDatabase::build(Group& group, const std::vector<uint8_t>& goal) {
+    // Breadth-first search backward from the goal over abstract states: the
+    // cells of the group's tiles plus the region of free cells the blank is in.
+    // Moving the blank inside its region costs nothing, so a region is
+    // represented by its lowest cell; moving a group tile costs one.
+    const int count = static_cast<int>(group.tiles.size());
+    const uint64_t placements = tableSize(count);
+    const uint64_t bytes = storageSize(count, _storageEncoding);
+    uint8_t* costs = new uint8_t[bytes];
+    std::memset(costs, 0, bytes);
+    group.storage = std::shared_ptr<const uint8_t>(costs, std::default_delete<uint8_t[]>());
+    group.costs = costs;
+
+    // One word per placement: which blank regions were reached (low 16 bits)
+    // and the placement's cost (above), so a successor costs one cache miss
+    std::vector<uint32_t> seen(placements, static_cast<uint32_t>(UNVISITED) << CELLS);
+
+    uint8_t cells[CELLS];
+    int blank = 0;
+    for (int i = 0; i < CELLS; i++) {
+        if (goal[i] == 0) {
+            blank = i;
+        }
+        for (int t = 0; t < count; t++) {
+            if (goal[i] == group.tiles[t]) {
+                cells[t] = static_cast<uint8_t>(i);
+            }
+        }
+    }
+
+    // Every blank cell of a newly reached region shares its cost: write them
+    // all into the per-blank encodings (min-blank only keeps the placement's)
+    auto record = [&](const uint8_t* at, uint64_t placement, uint32_t region, int depth) {
+        if (_storageEncoding == ENCODING_MIN_BLANK) {
+            return;
+        }
+        uint32_t occupied = 0;
+        for (int t = 0; t < count; t++) {
+            occupied |= 1u << at[t];
+        }
+        int value = depth;
+        if (_storageEncoding == ENCODING_NIBBLE) {
+            value = std::min((depth - groupDistance(group, at)) / 2, MAX_NIBBLE);
+        } else if (_storageEncoding == ENCODING_MOD3) {
+            value = depth % 3;
+        }
+        for (uint32_t remaining = region; remaining; remaining &= remaining - 1) {
+            int cell = __builtin_ctz(remaining);
+            uint64_t index = placement * (CELLS - count)
+                           + (cell - __builtin_popcount(occupied & ((1u << cell) - 1)));
+            switch (_storageEncoding) {
+                case ENCODING_NIBBLE:
+                    costs[index >> 1] |= static_cast<uint8_t>(value << ((index & 1) * 4));
+                    break;
+                case ENCODING_MOD3:
+                    costs[index >> 2] |= static_cast<uint8_t>(value << ((index & 3) * 2));
+                    break;
+                default:
+                    costs[index] = static_cast<uint8_t>(value);
+                    break;
+            }
+        }
+    };
+
+    // Queue entries carry the cells themselves, a nibble each, with the
+    // region's cell on top: expanding an entry needs no unranking
+    uint32_t occupied = 0;
+    for (int t = 0; t < count; t++) {
+        occupied |= 1u << cells[t];
+    }
+    uint32_t region = floodBlank(1u << blank, ALL_CELLS & ~occupied);
+    uint64_t startPlacement = rank(cells, count);
+    seen[startPlacement] = 1u << __builtin_ctz(region);
+    record(cells, startPlacement, region, 0);
+
+    std::vector<uint64_t> current(1, pack(cells, count, __builtin_ctz(region)));
+    std::vector<uint64_t> next;
+
+    for (int depth = 1; !current.empty(); depth++) {
+        next.clear();
+        for (uint64_t entry : current) {
+            occupied = 0;
+            for (int t = 0; t < count; t++) {
+                cells[t] = static_cast<uint8_t>((entry >> (4 * t)) & 0xF);
+                occupied |= 1u << cells[t];
+            }
+            uint32_t freeCells = ALL_CELLS & ~occupied;
+            region = floodBlank(1u << ((entry >> (4 * count)) & 0xF), freeCells);
+
+            // Slide any group tile next to the blank's region into it
+            for (int t = 0; t < count; t++) {
+                int from = cells[t];
+                for (int move = 0; move < MOVE_COUNT; move++) {
+                    int to = Board<SIZE>::NEIGHBORS[from][move];
+                    if (to == Board<SIZE>::NO_CELL || !(region & (1u << to))) {
+                        continue;
+                    }
+
+                    cells[t] = static_cast<uint8_t>(to);
+                    uint32_t newFree = (freeCells | (1u << from)) & ~(1u << to);
+                    uint32_t newRegion = floodBlank(1u << from, newFree);
+                    int newRegionCell = __builtin_ctz(newRegion);
+                    uint64_t placement = rank(cells, count);
+                    uint32_t& word = seen[placement];
+
+                    if (!(word & (1u << newRegionCell))) {
+                        // Layers are in cost order: the first time a placement
+                        // shows up is its cost
+                        if ((word >> CELLS) == UNVISITED) {
+                            word = static_cast<uint32_t>(depth) << CELLS;
+                        }
+                        word |= 1u << newRegionCell;
+                        record(cells, placement, newRegion, depth);
+                        next.push_back(pack(cells, count, newRegionCell));
+                    }
+                    cells[t] = static_cast<uint8_t>(from);
+                }
+            }
+        }
+        current.swap(next);
+    }
+
+    if (_storageEncoding == ENCODING_MIN_BLANK) {
+        for (uint64_t i = 0; i < placements; i++) {
+            costs[i] = static_cast<uint8_t>(seen[i] >> CELLS);
+        }
+    }
+}
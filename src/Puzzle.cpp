@@ -48,7 +48,8 @@ void Puzzle::generateGoalSnail() {
     int y = 0;
     int iy = 0;
     
-    while (true) {
+    // Exactly one cell is filled per step; the blank (0) is placed last
+    for (int placed = 0; placed < ts; placed++) {
         goalFlat[x + y * _size] = cur;
         if (cur == 0) {
             break;
@@ -79,6 +80,12 @@ void Puzzle::generateGoalSnail() {
 }
 
 void Puzzle::generatePuzzle() {
+    generatePuzzle(static_cast<unsigned int>(std::time(nullptr)));
+}
+
+void Puzzle::generatePuzzle(unsigned int seed) {
+    // Same seed, size and iterations give the same board
+    std::srand(seed);
     if (_solvable) {
         generateSolvablePuzzle();
     } else {
@@ -91,7 +98,6 @@ void Puzzle::generateSolvablePuzzle() {
     _grid = _goal;  // Copy goal state
     
     // Shuffle by swapping blank tile with adjacent tiles
-    std::srand(std::time(nullptr));
     for (int i = 0; i < _iterations; i++) {
         swapEmpty(_grid);
     }
@@ -102,7 +108,6 @@ void Puzzle::generateUnsolvablePuzzle() {
     _grid = _goal;  // Copy goal state
     
     // Shuffle by swapping blank tile with adjacent tiles
-    std::srand(std::time(nullptr));
     for (int i = 0; i < _iterations; i++) {
         swapEmpty(_grid);
     }
@@ -77,19 +77,17 @@ std::string SolutionLogger::stateToString(const std::vector<uint8_t>& state, int
     return ss.str();
 }
 
-std::vector<std::shared_ptr<Node>> SolutionLogger::reconstructPath(std::shared_ptr<Node> goalNode) {
-    std::vector<std::shared_ptr<Node>> path;
+void SolutionLogger::applyMove(std::vector<uint8_t>& state, int size, int move) {
+    int zeroPos = static_cast<int>(std::find(state.begin(), state.end(), 0) - state.begin());
+    int row = zeroPos / size;
+    int col = zeroPos % size;
     
-    std::shared_ptr<Node> current = goalNode;
-    while (current) {
-        path.push_back(current);
-        current = current->getParent();
-    }
-    
-    // Reverse to get path from start to goal
-    std::reverse(path.begin(), path.end());
+    if (move == MOVE_UP) row--;
+    else if (move == MOVE_DOWN) row++;
+    else if (move == MOVE_LEFT) col--;
+    else col++;
     
-    return path;
+    std::swap(state[zeroPos], state[row * size + col]);
 }
 
 void SolutionLogger::logSolution(
@@ -98,7 +96,7 @@ void SolutionLogger::logSolution(
     const std::vector<uint8_t>& initialState,
     const std::vector<uint8_t>& goalState,
     int size,
-    std::shared_ptr<Node> goalNode,
+    const std::vector<uint8_t>& path,
     int moves,
     int timeComplexity,
     int spaceComplexity,
@@ -161,16 +159,19 @@ void SolutionLogger::logSolution(
     file << "SOLUTION PATH (" << moves << " moves)\n";
     file << std::string(70, '-') << "\n\n";
     
-    std::vector<std::shared_ptr<Node>> path = reconstructPath(goalNode);
+    // Replay the moves forward from the initial board
+    static const char* const actions[MOVE_COUNT] = {"up", "down", "left", "right"};
+    std::vector<uint8_t> state = initialState;
     
-    for (size_t i = 0; i < path.size(); i++) {
+    for (size_t i = 0; i <= path.size(); i++) {
         file << "Step " << i << ": ";
         if (i == 0) {
             file << "Initial State\n";
         } else {
-            file << "Move " << path[i]->getAction() << "\n";
+            applyMove(state, size, path[i - 1]);
+            file << "Move " << actions[path[i - 1]] << "\n";
         }
-        file << stateToString(path[i]->getState(), size);
+        file << stateToString(state, size);
         file << "\n";
     }
     
@@ -246,4 +247,3 @@ void SolutionLogger::logFailure(
     
     std::cout << "\n[Failure Log] Saved to: " << filename << "\n";
 }
-
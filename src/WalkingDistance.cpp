@@ -0,0 +1,120 @@
+#include "../includes/WalkingDistance.hpp"
+#include <algorithm>
+#include <map>
+#include <mutex>
+#include <utility>
+
+WalkingDistance::WalkingDistance() : _size(0), _distance(), _next(), _patterns() {}
+
+WalkingDistance::WalkingDistance(int size, int goalBlankLine)
+    : _size(size), _distance(), _next(), _patterns() {
+    build(goalBlankLine);
+}
+
+WalkingDistance::~WalkingDistance() {}
+
+WalkingDistance::WalkingDistance(const WalkingDistance& other)
+    : _size(other._size), _distance(other._distance), _next(other._next),
+      _patterns(other._patterns) {}
+
+WalkingDistance& WalkingDistance::operator=(const WalkingDistance& other) {
+    if (this != &other) {
+        _size = other._size;
+        _distance = other._distance;
+        _next = other._next;
+        _patterns = other._patterns;
+    }
+    return *this;
+}
+
+bool WalkingDistance::isSupported(int size) {
+    return size <= MAX_SIZE;
+}
+
+const WalkingDistance& WalkingDistance::get(int size, int goalBlankLine) {
+    static std::map<std::pair<int, int>, WalkingDistance> tables;
+    static std::mutex tablesMutex;
+
+    std::lock_guard<std::mutex> lock(tablesMutex);
+    std::pair<int, int> key(size, goalBlankLine);
+    auto it = tables.find(key);
+    if (it != tables.end()) {
+        return it->second;
+    }
+    WalkingDistance& table = tables[key];
+    table = WalkingDistance(size, goalBlankLine);
+    return table;
+}
+
+uint64_t WalkingDistance::pack(const uint8_t* counts, int blankLine, int size) {
+    uint64_t packed = static_cast<uint64_t>(blankLine);
+    for (int i = 0; i < size * size; i++) {
+        packed = (packed << BITS_PER_COUNT) | counts[i];
+    }
+    return packed;
+}
+
+uint32_t WalkingDistance::find(const uint8_t* counts, int blankLine) const {
+    auto it = _patterns.find(pack(counts, blankLine, _size));
+    return it != _patterns.end() ? it->second : NO_PATTERN;
+}
+
+uint32_t WalkingDistance::next(uint32_t pattern, bool forward, int goalLine) const {
+    return _next[(static_cast<size_t>(pattern) * 2 + (forward ? 1 : 0)) * _size + goalLine];
+}
+
+int WalkingDistance::distance(uint32_t pattern) const {
+    return _distance[pattern];
+}
+
+size_t WalkingDistance::getPatternCount() const {
+    return _distance.size();
+}
+
+void WalkingDistance::build(int goalBlankLine) {
+    // Breadth-first search from the goal pattern: every line holds its own
+    // tiles, one fewer on the blank's line. Patterns are numbered in the order
+    // they are found, so a pattern's successors can be recorded while it is
+    // expanded.
+    const int cells = _size * _size;
+    std::vector<uint8_t> counts(cells, 0);
+    for (int line = 0; line < _size; line++) {
+        counts[line * _size + line] = static_cast<uint8_t>(line == goalBlankLine ? _size - 1 : _size);
+    }
+
+    std::vector<uint8_t> queue(counts);     // Counts of every pattern, by pattern
+    std::vector<uint8_t> blankLines(1, static_cast<uint8_t>(goalBlankLine));
+    _patterns[pack(counts.data(), goalBlankLine, _size)] = 0;
+    _distance.push_back(0);
+
+    for (uint32_t pattern = 0; pattern < _distance.size(); pattern++) {
+        int blankLine = blankLines[pattern];
+        for (int forward = 0; forward < 2; forward++) {
+            int fromLine = forward ? blankLine + 1 : blankLine - 1;
+            for (int goalLine = 0; goalLine < _size; goalLine++) {
+                uint32_t successor = NO_PATTERN;
+                if (fromLine >= 0 && fromLine < _size
+                    && queue[pattern * cells + fromLine * _size + goalLine] > 0) {
+                    // A tile of goalLine slides from fromLine onto the blank's line
+                    std::copy(queue.begin() + pattern * cells,
+                              queue.begin() + (pattern + 1) * cells, counts.begin());
+                    counts[fromLine * _size + goalLine]--;
+                    counts[blankLine * _size + goalLine]++;
+
+                    uint64_t key = pack(counts.data(), fromLine, _size);
+                    auto found = _patterns.find(key);
+                    if (found == _patterns.end()) {
+                        successor = static_cast<uint32_t>(_distance.size());
+                        _patterns[key] = successor;
+                        _distance.push_back(static_cast<uint8_t>(_distance[pattern] + 1));
+                        queue.insert(queue.end(), counts.begin(), counts.end());
+                        blankLines.push_back(static_cast<uint8_t>(fromLine));
+                    } else {
+                        successor = found->second;
+                    }
+                }
+                _next.push_back(successor);
+            }
+        }
+    }
+}
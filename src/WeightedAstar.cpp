@@ -1,10 +1,10 @@
 #include "../includes/WeightedAstar.hpp"
 #include "../includes/Heuristic.hpp"
 #include "../includes/SolutionLogger.hpp"
+#include "../includes/StateTable.hpp"
+#include "../includes/NodeArena.hpp"
+#include "../includes/BucketQueue.hpp"
 #include <iostream>
-#include <queue>
-#include <unordered_set>
-#include <unordered_map>
 #include <chrono>
 #include <iomanip>
 #include <algorithm>
@@ -25,71 +25,56 @@ WeightedAstar& WeightedAstar::operator=(const WeightedAstar& other) {
 }
 
 // Estimate memory usage in bytes
+template <int N>
 size_t WeightedAstar::estimateMemoryUsage(size_t numStates) {
-    const size_t BYTES_PER_NODE = 60;
-    const size_t HASH_OVERHEAD = 16;
-    return numStates * (BYTES_PER_NODE + HASH_OVERHEAD * 2);
+    // Arena node plus its open-list pointer; no parent chain is kept alive
+    const size_t BYTES_PER_NODE = sizeof(Node<N>) + sizeof(Node<N>*);
+    return numStates * (BYTES_PER_NODE + StateTable<N, SearchEntry>::bytesPerEntry());
 }
 
-void WeightedAstar::getNeighbors(const Node& node, std::vector<Neighbor>& neighbors) {
+template <int N>
+void WeightedAstar::getNeighbors(const Node<N>& node, std::vector<Neighbor<N>>& neighbors) {
     neighbors.clear();
     
-    const std::vector<uint8_t>& state = node.getState();
-    int size = node.getSize();
+    const State<N>& state = node.getState();
     uint8_t zeroPos = node.getZeroPos();
     
-    int row = zeroPos / size;
-    int col = zeroPos % size;
-    
-    // Define possible moves: up, down, left, right
-    struct Move {
-        int dr, dc;
-        const char* action;
-    };
-    
-    static const Move moves[] = {
-        {-1, 0, "up"},
-        {1, 0, "down"},
-        {0, -1, "left"},
-        {0, 1, "right"}
-    };
-    
-    neighbors.reserve(4);
-    
-    for (const auto& move : moves) {
-        int newRow = row + move.dr;
-        int newCol = col + move.dc;
+    for (int move = 0; move < MOVE_COUNT; move++) {
+        int newZeroPos = Board<N>::NEIGHBORS[zeroPos][move];
         
         // Check if move is valid
-        if (newRow >= 0 && newRow < size && newCol >= 0 && newCol < size) {
-            uint8_t newZeroPos = newRow * size + newCol;
+        if (newZeroPos != Board<N>::NO_CELL) {
+            // Create new state by sliding the target tile into the blank
+            State<N> newState = state;
+            newState.slide(zeroPos, newZeroPos);
             
-            // Create new state by swapping blank with target tile
-            std::vector<uint8_t> newState = state;
-            std::swap(newState[zeroPos], newState[newZeroPos]);
-            
-            // Use emplace_back with move semantics to avoid extra copy
-            neighbors.emplace_back(Neighbor{std::move(newState), newZeroPos, move.action});
+            neighbors.emplace_back(Neighbor<N>{newState, static_cast<uint8_t>(newZeroPos), static_cast<uint8_t>(move)});
         }
     }
 }
 
-bool WeightedAstar::isGoal(const std::vector<uint8_t>& state,
-                           const std::vector<uint8_t>& goal) {
+template <int N>
+bool WeightedAstar::isGoal(const State<N>& state, const State<N>& goal) {
     return state == goal;
 }
 
-AStarResult WeightedAstar::solve(Puzzle& puzzle, int size, int heuristic, bool silent, 
-                                 size_t maxStates, double maxTimeSeconds, double weight) {
+template <int N>
+AStarResult WeightedAstar::solve(Puzzle& puzzle, int heuristic, bool silent, 
+                                 size_t maxStates, double maxTimeSeconds, double weight,
+                                 TieBreaking tieBreaking) {
     auto startTime = std::chrono::high_resolution_clock::now();
     
     // Get initial state and goal
     const std::vector<uint8_t>& initialState = puzzle.getGrid();
     const std::vector<uint8_t>& goal = puzzle.getGoal();
     
+    // Packed search representation of the start and goal boards
+    const State<N> initial(initialState);
+    const State<N> goalState(goal);
+    
     // Display memory, time limits (set by Game class), and weight configuration
     if (!silent) {
-        size_t estimatedMB = estimateMemoryUsage(maxStates) / (1024 * 1024);
+        size_t estimatedMB = estimateMemoryUsage<N>(maxStates) / (1024 * 1024);
         std::cout << "\n[Memory Safety] Max states limited to " << maxStates 
                  << " (~" << estimatedMB << " MB)\n";
         std::cout << "[Time Safety] Max execution time: " << maxTimeSeconds << " seconds\n";
@@ -97,14 +82,14 @@ AStarResult WeightedAstar::solve(Puzzle& puzzle, int size, int heuristic, bool s
     }
     
     // Check if already at goal
-    if (isGoal(initialState, goal)) {
+    if (isGoal(initial, goalState)) {
         if (!silent) {
             std::cout << "\nPuzzle is already solved!\n";
         }
         auto endTime = std::chrono::high_resolution_clock::now();
         double duration = std::chrono::duration<double>(endTime - startTime).count();
         
-        return {true, 0, 0, 0, duration, heuristic, "", 1, "Weighted A*", false, "", weight};
+        return {true, 0, 0, 0, duration, heuristic, "", 1, "Weighted A*", false, "", weight, {}, tieBreaking};
     }
     
     // Check if puzzle is solvable
@@ -116,11 +101,11 @@ AStarResult WeightedAstar::solve(Puzzle& puzzle, int size, int heuristic, bool s
         double duration = std::chrono::duration<double>(endTime - startTime).count();
         
         return {false, 0, 0, 0, duration, heuristic, "", 1, "Weighted A*", false, 
-                "Puzzle is unsolvable", weight};
+                "Puzzle is unsolvable", weight, {}, tieBreaking};
     }
     
-    // Pre-compute goal lookup table once
-    GoalLookup goalLookup(goal, size);
+    // Goal lookup and per-move delta tables, built once per goal and heuristic
+    const Heuristic<N>& estimator = Heuristic<N>::get(goal, heuristic);
     
     // Initialize statistics
     int totalSetOpened = 0;
@@ -136,27 +121,28 @@ AStarResult WeightedAstar::solve(Puzzle& puzzle, int size, int heuristic, bool s
     }
     
     // Calculate initial heuristic and apply weight
-    int initialH = Heuristic::getHeuristicValue(initialState, goalLookup, size, heuristic);
+    HeuristicCache<N> initialCache;
+    int initialH = estimator.evaluate(initial, initialCache);
     int weightedInitialH = static_cast<int>(weight * initialH);
     
-    // Create initial node (with optional parent tracking for logging)
-    auto startNode = std::make_shared<Node>(initialState, size, initialZeroPos, 0, weightedInitialH, nullptr, "");
+    // All nodes of this search live in one arena, released in one shot on return
+    NodeArena<Node<N>> nodes;
     
-    // Priority queue for open set
-    std::priority_queue<std::shared_ptr<Node>, 
-                       std::vector<std::shared_ptr<Node>>, 
-                       NodePtrComparator> openSet;
-    openSet.push(startNode);
+    // Create initial node
+    Node<N>* startNode = nodes.create(initial, initialZeroPos, 0, weightedInitialH, initialCache);
     
-    // Set to track visited states (closed set)
-    std::unordered_set<size_t> closedSet;
+    // Open set bucketed by g + w*h, then g
+    BucketQueue<Node<N>*> openSet(tieBreaking);
+    openSet.push(startNode);
     
-    // Dictionary to track best cost to reach each state
-    std::unordered_map<size_t, int> gScores;
-    gScores[startNode->hash()] = 0;
+    // Closed set and best path costs in one open-addressing table keyed by
+    // the full board (no hash-collision pruning, one probe per child)
+    StateTable<N, SearchEntry> table(maxStates);
+    bool startInserted;
+    table.findOrInsert(initial, startInserted) = SearchEntry{0, false, MOVE_UP};
     
     // Reusable neighbor vector
-    std::vector<Neighbor> neighbors;
+    std::vector<Neighbor<N>> neighbors;
     neighbors.reserve(4);
     
     while (!openSet.empty()) {
@@ -181,12 +167,13 @@ AStarResult WeightedAstar::solve(Puzzle& puzzle, int size, int heuristic, bool s
                 }
                 
                 return {false, 0, totalSetOpened, maxStatesEnqueued, elapsed, heuristic, "", 
-                        1, "Weighted A*", false, "Timeout reached", weight};
+                        1, "Weighted A*", false, "Timeout reached", weight, {}, tieBreaking};
             }
         }
         
-        // Memory limit check
-        if (totalSetOpened >= static_cast<int>(maxStates)) {
+        // Memory limit check - every node created stays in the arena until
+        // the search returns, so count those rather than expansions
+        if (nodes.size() >= maxStates) {
             auto endTime = std::chrono::high_resolution_clock::now();
             double duration = std::chrono::duration<double>(endTime - startTime).count();
             
@@ -197,24 +184,23 @@ AStarResult WeightedAstar::solve(Puzzle& puzzle, int size, int heuristic, bool s
                 std::cout << "Explored " << totalSetOpened << " states before hitting limit\n";
                 std::cout << "Maximum states in memory: " << maxStatesEnqueued << "\n";
                 std::cout << "Estimated memory used: " 
-                         << (estimateMemoryUsage(totalSetOpened) / (1024 * 1024)) << " MB\n";
+                         << (estimateMemoryUsage<N>(totalSetOpened) / (1024 * 1024)) << " MB\n";
                 std::cout << "Execution time: " << std::fixed << std::setprecision(4) 
                          << duration << "s\n";
             }
             
             return {false, 0, totalSetOpened, maxStatesEnqueued, duration, heuristic, "", 
-                    1, "Weighted A*", true, "Memory limit reached", weight};
+                    1, "Weighted A*", true, "Memory limit reached", weight, {}, tieBreaking};
         }
         
         // Get node with lowest f value
-        auto current = openSet.top();
+        Node<N>* current = openSet.top();
         openSet.pop();
         
         // Check if we reached the goal
-        if (isGoal(current->getState(), goal)) {
-            // Get real path cost from gScores (since we use weighted h for sorting)
-            size_t goalHash = current->hash();
-            int moves = gScores[goalHash];
+        if (isGoal(current->getState(), goalState)) {
+            // Get real path cost from the table (the node only carries the sort key)
+            int moves = table.find(current->getState())->g;
             
             auto endTime = std::chrono::high_resolution_clock::now();
             double duration = std::chrono::duration<double>(endTime - startTime).count();
@@ -226,33 +212,32 @@ AStarResult WeightedAstar::solve(Puzzle& puzzle, int size, int heuristic, bool s
                 std::cout << "Total moves required: " << moves << "\n";
                 std::cout << "Total states opened (time complexity): " << totalSetOpened << "\n";
                 std::cout << "Maximum states in memory (space complexity): " << maxStatesEnqueued << "\n";
+                std::cout << "Tie-breaking: " << getTieBreakingName(tieBreaking) << "\n";
                 std::cout << "Execution time: " << std::fixed << std::setprecision(4) 
                          << duration << "s\n";
                 std::cout << "Weight used: " << weight << "\n";
                 std::cout << std::string(50, '=') << "\n";
                 
                 // Log solution to file
-                std::string heuristicName;
-                if (heuristic == 1) heuristicName = "Manhattan Distance";
-                else if (heuristic == 2) heuristicName = "Hamming Distance";
-                else if (heuristic == 3) heuristicName = "Linear Conflict";
+                std::string heuristicName = getHeuristicName(heuristic);
                 
                 SolutionLogger::logSolution(
-                    "Weighted A*", heuristicName, initialState, goal, size,
-                    current, moves, totalSetOpened, maxStatesEnqueued, duration, weight
+                    "Weighted A*", heuristicName, initialState, goal, N,
+                    tracePath(table, initial, current->getState()), moves, totalSetOpened, maxStatesEnqueued, duration, weight
                 );
             }
             
             return {true, moves, totalSetOpened, maxStatesEnqueued, duration, heuristic, "", 
-                    1, "Weighted A*", false, "", weight};
+                    1, "Weighted A*", false, "", weight, {}, tieBreaking};
         }
         
-        // Add current state to closed set
-        size_t currentHash = current->hash();
-        if (closedSet.find(currentHash) != closedSet.end()) {
+        // Add current state to closed set (its entry was created when it was pushed)
+        SearchEntry* currentEntry = table.find(current->getState());
+        if (currentEntry->closed) {
             continue;
         }
-        closedSet.insert(currentHash);
+        currentEntry->closed = true;
+        int currentG = currentEntry->g;  // Copied: inserting children may move the entry
         totalSetOpened++;
         
         // Generate and process neighbors
@@ -260,60 +245,375 @@ AStarResult WeightedAstar::solve(Puzzle& puzzle, int size, int heuristic, bool s
         
         for (auto& neighbor : neighbors) {
             // Calculate real g-cost (actual path cost)
-            int realGCost = gScores[currentHash] + 1;
+            int realGCost = currentG + 1;
+            
+            // One probe: skip closed states and paths that are not better
+            bool inserted;
+            SearchEntry& entry = table.findOrInsert(neighbor.state, inserted);
+            if (!inserted && (entry.closed || entry.g <= realGCost)) {
+                continue;
+            }
+            
+            // Record the real path cost
+            entry.g = realGCost;
+            entry.move = neighbor.move;
             
             // Calculate heuristic and apply weight
-            int hCost = Heuristic::getHeuristicValue(neighbor.state, goalLookup, size, heuristic);
+            // Only the slid tile changed: update the parent's cached heuristic parts
+            HeuristicCache<N> cache;
+            int hCost = estimator.evaluateMove(neighbor.state, current->getZeroPos(), neighbor.move,
+                                               current->getHeuristicCache(), cache);
             int weightedHCost = static_cast<int>(weight * hCost);
             
             // Create neighbor node with weighted heuristic
-            auto neighborNode = std::make_shared<Node>(
-                std::move(neighbor.state),
-                size,
+            Node<N>* neighborNode = nodes.create(
+                neighbor.state,
                 neighbor.zeroPos,
                 realGCost,        // Real g-cost for f-value calculation
                 weightedHCost,    // Weighted h-cost
-                current,          // Track parent for path reconstruction
-                neighbor.action   // Track action that led to this state
+                cache             // Unweighted parts, for incremental updates
             );
             
-            size_t neighborHash = neighborNode->hash();
+            // Add to open set
+            openSet.push(neighborNode);
+        }
+    }
+    
+    // No solution found
+    auto endTime = std::chrono::high_resolution_clock::now();
+    double duration = std::chrono::duration<double>(endTime - startTime).count();
+    
+    if (!silent) {
+        std::cout << "\n" << std::string(50, '=') << "\n";
+        std::cout << "No solution found! Puzzle may be unsolvable.\n";
+        std::cout << std::string(50, '=') << "\n";
+        std::cout << "Total states opened: " << totalSetOpened << "\n";
+        std::cout << "Maximum states in memory: " << maxStatesEnqueued << "\n";
+        std::cout << "Execution time: " << std::fixed << std::setprecision(4) 
+                 << duration << "s\n";
+        std::cout << std::string(50, '=') << "\n";
+    }
+    
+    return {false, 0, totalSetOpened, maxStatesEnqueued, duration, heuristic, "", 
+            1, "Weighted A*", false, "No solution found", weight, {}, tieBreaking};
+}
+
+template <int N>
+AStarResult WeightedAstar::solveAnytime(Puzzle& puzzle, int heuristic, bool silent,
+                                        size_t maxStates, double maxTimeSeconds, double initialWeight,
+                                        double weightStep, TieBreaking tieBreaking) {
+    auto startTime = std::chrono::high_resolution_clock::now();
+    
+    // Get initial state and goal
+    const std::vector<uint8_t>& initialState = puzzle.getGrid();
+    const std::vector<uint8_t>& goal = puzzle.getGoal();
+    
+    // Packed search representation of the start and goal boards
+    const State<N> initial(initialState);
+    const State<N> goalState(goal);
+    
+    // Below 1 the passes would never reach an optimal one
+    double weight = std::max(1.0, initialWeight);
+    weightStep = std::max(weightStep, 0.1);
+    
+    // Display memory, time limits (set by Game class), and weight schedule
+    if (!silent) {
+        size_t estimatedMB = estimateMemoryUsage<N>(maxStates) / (1024 * 1024);
+        std::cout << "\n[Memory Safety] Max states limited to " << maxStates 
+                 << " (~" << estimatedMB << " MB)\n";
+        std::cout << "[Time Safety] Max execution time: " << maxTimeSeconds 
+                 << " seconds (best solution so far returned then)\n";
+        std::cout << "[ARA*] Weight " << weight << ", lowered by " << weightStep << " down to 1\n";
+    }
+    
+    // Check if already at goal
+    if (isGoal(initial, goalState)) {
+        if (!silent) {
+            std::cout << "\nPuzzle is already solved!\n";
+        }
+        auto endTime = std::chrono::high_resolution_clock::now();
+        double duration = std::chrono::duration<double>(endTime - startTime).count();
+        
+        return {true, 0, 0, 0, duration, heuristic, "", 14, "ARA*", false, "", 1.0, {}, tieBreaking};
+    }
+    
+    // Check if puzzle is solvable
+    if (!puzzle.isSolvable()) {
+        if (!silent) {
+            std::cout << "\nPuzzle is unsolvable!\n";
+        }
+        auto endTime = std::chrono::high_resolution_clock::now();
+        double duration = std::chrono::duration<double>(endTime - startTime).count();
+        
+        return {false, 0, 0, 0, duration, heuristic, "", 14, "ARA*", false, 
+                "Puzzle is unsolvable", weight, {}, tieBreaking};
+    }
+    
+    // Goal lookup and per-move delta tables, built once per goal and heuristic
+    const Heuristic<N>& estimator = Heuristic<N>::get(goal, heuristic);
+    
+    // Initialize statistics
+    int totalSetOpened = 0;
+    int maxStatesEnqueued = 0;
+    
+    // Find initial blank position
+    uint8_t initialZeroPos = 0;
+    for (size_t i = 0; i < initialState.size(); i++) {
+        if (initialState[i] == 0) {
+            initialZeroPos = static_cast<uint8_t>(i);
+            break;
+        }
+    }
+    
+    HeuristicCache<N> initialCache;
+    int initialH = estimator.evaluate(initial, initialCache);
+    
+    // Nodes outlive a pass; those dropped from the open list are recycled
+    NodeArena<Node<N>> nodes;
+    BucketQueue<Node<N>*> openSet(tieBreaking);
+    openSet.push(nodes.create(initial, initialZeroPos, 0, static_cast<int>(weight * initialH), initialCache));
+    
+    // Shared by every pass: best g and move per state, closed = expanded in
+    // the current pass (reset from closedStates when the next one starts)
+    StateTable<N, SearchEntry> table(maxStates);
+    bool startInserted;
+    table.findOrInsert(initial, startInserted) = SearchEntry{0, false, MOVE_UP};
+    std::vector<State<N>> closedStates;
+    std::vector<Node<N>*> inconsistent;
+    
+    // Best solution so far, and the largest proven lower bound on the optimal cost
+    int bestCost = INT_MAX;
+    int knownLowerBound = initialH;
+    std::vector<uint8_t> bestPath;
+    double bestBound = 0;
+    double bestWeight = weight;
+    int passes = 0;
+    std::string stopReason;
+    bool memoryLimitReached = false;
+    
+    std::vector<Neighbor<N>> neighbors;
+    neighbors.reserve(4);
+    
+    while (stopReason.empty()) {
+        passes++;
+        
+        // One pass: expand while a node could still beat the best solution
+        while (!openSet.empty() && openSet.top()->getFValue() < bestCost) {
+            maxStatesEnqueued = std::max(maxStatesEnqueued, (int)openSet.size());
             
-            // Skip if already visited
-            if (closedSet.find(neighborHash) != closedSet.end()) {
-                continue;
+            // Timeout check
+            if (maxTimeSeconds > 0) {
+                auto currentTime = std::chrono::high_resolution_clock::now();
+                double elapsed = std::chrono::duration<double>(currentTime - startTime).count();
+                if (elapsed > maxTimeSeconds) {
+                    stopReason = "Timeout reached";
+                    break;
+                }
             }
             
-            // Check if this is a better path to this state
-            if (gScores.find(neighborHash) != gScores.end() && 
-                gScores[neighborHash] <= realGCost) {
+            // Memory limit check - expanded nodes are recycled, so count the
+            // states in the table, which keeps every state seen
+            if (table.size() >= maxStates) {
+                stopReason = "Memory limit reached";
+                memoryLimitReached = true;
+                break;
+            }
+            
+            Node<N>* current = openSet.top();
+            openSet.pop();
+            
+            // Skip copies left behind by a better path or an earlier expansion
+            SearchEntry* currentEntry = table.find(current->getState());
+            if (currentEntry->closed || current->getCost() != currentEntry->g) {
+                nodes.release(current);
                 continue;
             }
+            currentEntry->closed = true;
+            int currentG = currentEntry->g;  // Copied: inserting children may move the entry
+            closedStates.push_back(current->getState());
+            totalSetOpened++;
             
-            // Record the real path cost
-            gScores[neighborHash] = realGCost;
+            getNeighbors(*current, neighbors);
             
-            // Add to open set
-            openSet.push(neighborNode);
+            for (auto& neighbor : neighbors) {
+                int realGCost = currentG + 1;
+                
+                bool inserted;
+                SearchEntry& entry = table.findOrInsert(neighbor.state, inserted);
+                if (!inserted && entry.g <= realGCost) {
+                    continue;
+                }
+                entry.g = realGCost;
+                entry.move = neighbor.move;
+                bool closed = !inserted && entry.closed;
+                
+                HeuristicCache<N> cache;
+                int hCost = estimator.evaluateMove(neighbor.state, current->getZeroPos(), neighbor.move,
+                                                   current->getHeuristicCache(), cache);
+                Node<N>* neighborNode = nodes.create(neighbor.state, neighbor.zeroPos, realGCost,
+                                                     static_cast<int>(weight * hCost), cache);
+                
+                // Expanded this pass: its children wait for the next one
+                if (closed) {
+                    inconsistent.push_back(neighborNode);
+                } else {
+                    openSet.push(neighborNode);
+                }
+                
+                if (isGoal(neighbor.state, goalState)) {
+                    bestCost = std::min(bestCost, realGCost);
+                }
+            }
+            nodes.release(current);
+        }
+        
+        if (bestCost == INT_MAX) {
+            stopReason = stopReason.empty() ? "No solution found" : stopReason;
+            break;
+        }
+        if (!stopReason.empty()) {
+            // Cut short: keep a solution this pass already improved on
+            std::vector<uint8_t> path = tracePath(table, initial, goalState);
+            if (bestPath.empty() || path.size() < bestPath.size()) {
+                bestPath = path;
+                bestBound = static_cast<double>(bestPath.size()) / std::max(knownLowerBound, 1);
+                bestWeight = weight;
+            }
+            break;
+        }
+        
+        // Gather the open and INCONS nodes still current, with their unweighted
+        // f: the smallest is a lower bound on the optimal cost
+        std::vector<Node<N>*> pending;
+        pending.reserve(openSet.size() + inconsistent.size());
+        while (!openSet.empty()) {
+            pending.push_back(openSet.top());
+            openSet.pop();
+        }
+        pending.insert(pending.end(), inconsistent.begin(), inconsistent.end());
+        inconsistent.clear();
+        for (const State<N>& state : closedStates) {
+            table.find(state)->closed = false;
+        }
+        closedStates.clear();
+        
+        int lowerBound = bestCost;
+        std::vector<std::pair<Node<N>*, int>> frontier;
+        frontier.reserve(pending.size());
+        for (Node<N>* node : pending) {
+            const SearchEntry* entry = table.find(node->getState());
+            if (node->getCost() != entry->g || entry->closed) {
+                nodes.release(node);
+                continue;
+            }
+            // Marked so a second copy with the same g is dropped
+            table.find(node->getState())->closed = true;
+            HeuristicCache<N> cache;
+            int hCost = estimator.evaluate(node->getState(), cache);
+            lowerBound = std::min(lowerBound, node->getCost() + hCost);
+            frontier.emplace_back(node, hCost);
+        }
+        
+        // Report the solution of this pass with its bound
+        knownLowerBound = std::max(knownLowerBound, lowerBound);
+        std::vector<uint8_t> path = tracePath(table, initial, goalState);
+        double bound = std::min(weight, static_cast<double>(path.size()) / std::max(knownLowerBound, 1));
+        bool improved = bestPath.empty() || path.size() < bestPath.size();
+        bestPath = path;
+        bestBound = bound;
+        bestWeight = weight;
+        if (!silent) {
+            double elapsed = std::chrono::duration<double>(
+                std::chrono::high_resolution_clock::now() - startTime).count();
+            std::cout << "[ARA*] Pass " << passes << ", weight " << weight << ": "
+                     << bestPath.size() << " moves" << (improved ? "" : " (unchanged)")
+                     << ", at most " << std::fixed << std::setprecision(3) << bound
+                     << "x optimal (" << totalSetOpened << " states opened, "
+                     << std::setprecision(4) << elapsed << "s)\n";
+            std::cout.unsetf(std::ios::fixed);
+            std::cout << std::setprecision(6);
+        }
+        
+        // Optimal once the weight is 1 or the bound says so
+        if (weight <= 1.0 || static_cast<int>(bestPath.size()) <= knownLowerBound) {
+            bestBound = 1.0;
+            for (auto& item : frontier) {
+                nodes.release(item.first);
+            }
+            break;
+        }
+        
+        // Next pass: lower weight, open list rebuilt with the new keys
+        weight = std::max(1.0, weight - weightStep);
+        for (auto& item : frontier) {
+            Node<N>* node = item.first;
+            table.find(node->getState())->closed = false;
+            Node<N>* rekeyed = nodes.create(node->getState(), node->getZeroPos(), node->getCost(),
+                                            static_cast<int>(weight * item.second), node->getHeuristicCache());
+            nodes.release(node);
+            openSet.push(rekeyed);
         }
     }
     
-    // No solution found
     auto endTime = std::chrono::high_resolution_clock::now();
     double duration = std::chrono::duration<double>(endTime - startTime).count();
     
+    if (!bestPath.empty()) {
+        int moves = static_cast<int>(bestPath.size());
+        
+        if (!silent) {
+            std::cout << "\n" << std::string(50, '=') << "\n";
+            if (stopReason.empty()) {
+                std::cout << "Solution found!\n";
+            } else {
+                std::cout << "Solution found! (best one when stopped: " << stopReason << ")\n";
+            }
+            std::cout << std::string(50, '=') << "\n";
+            std::cout << "Total moves required: " << moves << "\n";
+            std::cout << "Total states opened (time complexity): " << totalSetOpened << "\n";
+            std::cout << "Maximum states in memory (space complexity): " << maxStatesEnqueued << "\n";
+            std::cout << "Tie-breaking: " << getTieBreakingName(tieBreaking) << "\n";
+            std::cout << "Execution time: " << std::fixed << std::setprecision(4) 
+                     << duration << "s\n";
+            std::cout.unsetf(std::ios::fixed);
+            std::cout << std::setprecision(6);
+            std::cout << "Passes: " << passes << ", last weight: " << bestWeight << "\n";
+            std::cout << "Suboptimality bound: " << bestBound
+                     << (bestBound <= 1.0 ? " (optimal)" : "") << "\n";
+            std::cout << std::string(50, '=') << "\n";
+            
+            SolutionLogger::logSolution(
+                "ARA*", getHeuristicName(heuristic), initialState, goal, N,
+                bestPath, moves, totalSetOpened, maxStatesEnqueued, duration, bestWeight
+            );
+        }
+        
+        return {true, moves, totalSetOpened, maxStatesEnqueued, duration, heuristic, "", 
+                14, "ARA*", false, "", bestWeight, {}, tieBreaking};
+    }
+    
     if (!silent) {
         std::cout << "\n" << std::string(50, '=') << "\n";
-        std::cout << "No solution found! Puzzle may be unsolvable.\n";
+        if (stopReason == "Timeout reached") {
+            std::cout << "⏱️  TIMEOUT REACHED!\n";
+        } else if (memoryLimitReached) {
+            std::cout << "⚠️  MEMORY LIMIT REACHED!\n";
+        } else {
+            std::cout << "No solution found! Puzzle may be unsolvable.\n";
+        }
         std::cout << std::string(50, '=') << "\n";
-        std::cout << "Total states opened: " << totalSetOpened << "\n";
+        std::cout << "Explored " << totalSetOpened << " states before a first solution\n";
         std::cout << "Maximum states in memory: " << maxStatesEnqueued << "\n";
         std::cout << "Execution time: " << std::fixed << std::setprecision(4) 
                  << duration << "s\n";
-        std::cout << std::string(50, '=') << "\n";
     }
     
     return {false, 0, totalSetOpened, maxStatesEnqueued, duration, heuristic, "", 
-            1, "Weighted A*", false, "No solution found", weight};
+            14, "ARA*", memoryLimitReached, stopReason, weight, {}, tieBreaking};
 }
 
+#define INSTANTIATE_WEIGHTEDASTAR(N) \
+    template AStarResult WeightedAstar::solve<N>(Puzzle&, int, bool, size_t, double, double, TieBreaking); \
+    template AStarResult WeightedAstar::solveAnytime<N>(Puzzle&, int, bool, size_t, double, double, double, \
+                                                        TieBreaking);
+NPUZZLE_FOR_EACH_SIZE(INSTANTIATE_WEIGHTEDASTAR)
@@ -1,8 +1,32 @@
 #include "../includes/Game.hpp"
+#include "../includes/CommandLine.hpp"
+#include "../includes/PatternDatabase.hpp"
+#include <iostream>
+#include <string>
+
+int main(int argc, char** argv) {
+    // make pdb: write the 4x4 pattern databases for the snail goal once,
+    // optionally in a given storage encoding (byte, nibble, mod3, min-blank)
+    if (argc > 1 && std::string(argv[1]) == "--generate-pdb") {
+        if (argc > 2) {
+            PatternDatabase::Encoding encoding;
+            if (!PatternDatabase::parseEncoding(argv[2], encoding)) {
+                std::cerr << "Unknown pattern database encoding: " << argv[2] << "\n";
+                return 1;
+            }
+            PatternDatabase::setEncoding(encoding);
+        }
+        Puzzle puzzle(PatternDatabase::SIZE, true, 0);
+        return PatternDatabase::generateFiles(puzzle.getGoal()) ? 0 : 1;
+    }
+
+    // Any other flag: solve one board non-interactively
+    if (argc > 1) {
+        CommandLine commandLine;
+        return commandLine.run(argc, argv);
+    }
 
-int main() {
     Game game;
     game.gameLoop(); 
     return 0;
 }
-